@@ -0,0 +1,43 @@
+#ifndef INCLUDED_MAX_FLOW_APP_CLI
+#define INCLUDED_MAX_FLOW_APP_CLI
+
+#include <max-flow/solve.hpp>
+#include <max-flow-app/test.hpp>
+#include <max-flow-app/families.hpp>
+#include <vector>
+#include <string>
+
+namespace MaxFlow::App
+{
+
+	// Benchmark campaign described by the command line and config files
+	// Every solver runs on every problem; list options accumulate, the other options override the previous value
+	struct BenchmarkOptions final
+	{
+		std::vector<ProblemParameters> problems{};
+		std::vector<SolverParameters> solvers{};
+		TestParameters test{ .repetitions{ 5 }, .seedRepetitions{ 5 }, .skipZeroFlows{ true } };
+		std::string output{ "benchmark.csv" };
+		// When set, the single random problem is streamed to this file instead of running the campaign
+		std::string generate{};
+		bool help{};
+		bool list{};
+	};
+
+	// "solver" or "solver:flag+flag", with the names used in the CSV files
+	SolverParameters parseSolverParameters(const std::string& _descriptor);
+	ESolverFlags parseSolverFlags(const std::string& _names);
+
+	// "--name value" or "--name=value"
+	void parseArguments(const std::vector<std::string>& _arguments, BenchmarkOptions& _options);
+	// One option per line, as "name value" or "name=value" without the leading dashes; '#' starts a comment
+	void parseConfigFile(const std::string& _file, BenchmarkOptions& _options);
+	BenchmarkOptions parseCommandLine(int _argc, const char* const* _argv);
+
+	std::string usage(const std::string& _program);
+	// Available suites, solvers, solver flags and problem families
+	std::string catalog();
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#ifndef INCLUDED_MAX_FLOW_APP_FAMILIES
+#define INCLUDED_MAX_FLOW_APP_FAMILIES
+
+#include <max-flow/graphs/flow.hpp>
+#include <max-flow/graphs/edge_list.hpp>
+#include <max-flow-app/random.hpp>
+#include <variant>
+#include <string>
+#include <istream>
+
+namespace MaxFlow::App
+{
+
+	// GENRMF (Goldfarb and Grigoriadis): frames of a×a grids, frames linked by random permutations
+	struct GenrmfParameters final
+	{
+
+		size_t frameSize{ 4 };
+		size_t framesCount{ 4 };
+		Graphs::flow_t minCapacity{ 1 };
+		Graphs::flow_t maxCapacity{ 1000 };
+
+		void validate() const;
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+
+	};
+
+	// Washington random level graph: a rows×columns grid where every vertex links to degree random vertices of the next column
+	struct WashingtonParameters final
+	{
+
+		size_t rows{ 16 };
+		size_t columns{ 16 };
+		size_t degree{ 3 };
+		Graphs::flow_t maxCapacity{ 10000 };
+
+		void validate() const;
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+
+	};
+
+	// AK-style instances (Cherkassky and Goldberg): long paths draining unit flows, which force push-relabel solvers through quadratically many relabels
+	struct AkParameters final
+	{
+
+		size_t length{ 100 };
+
+		void validate() const;
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+
+	};
+
+	// Bipartite matching networks: source to every left vertex, degree random right vertices per left vertex, every right vertex to sink
+	struct BipartiteParameters final
+	{
+
+		size_t leftCount{ 100 };
+		size_t rightCount{ 100 };
+		size_t degree{ 3 };
+		Graphs::flow_t maxCapacity{ 1 };
+
+		void validate() const;
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+
+	};
+
+	// Image segmentation grids: one vertex per pixel (or voxel), neighbor arcs in both directions and terminal arcs from unary costs of a synthetic image
+	// The image is made of regions around random seeds plus gaussian noise; intensities above one half prefer the source
+	struct GridParameters final
+	{
+
+		enum class ECapacities
+		{
+			// Independent uniform capacities in [1,maxCapacity]
+			Uniform,
+			// maxCapacity * exp(-(Ip - Iq)^2 / (2 contrastSigma^2)) / distance, as in boundary-aware segmentation
+			Contrast
+		};
+
+		size_t width{ 64 };
+		size_t height{ 64 };
+		size_t depth{ 1 };
+		// 4 or 8 when depth is 1, 6, 18 or 26 otherwise
+		size_t connectivity{ 4 };
+		ECapacities capacities{ ECapacities::Contrast };
+		Graphs::flow_t maxCapacity{ 100 };
+		Graphs::flow_t maxTerminalCapacity{ 100 };
+		// Fraction of the pixels with a terminal arc
+		double terminalDensity{ 0.5 };
+		size_t regionsCount{ 8 };
+		double noise{ 0.1 };
+		double contrastSigma{ 0.1 };
+
+		void validate() const;
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+		size_t terminalEdgesCount() const;
+
+	};
+
+	// Instance read from a DIMACS max-flow file ("p max", "n" and "a" lines); parallel arcs are merged and self loops dropped
+	struct DimacsParameters final
+	{
+
+		std::string file{};
+
+		void validate() const;
+
+	};
+
+	using ProblemParameters = std::variant<RandomParameters, GenrmfParameters, WashingtonParameters, AkParameters, BipartiteParameters, GridParameters, DimacsParameters>;
+
+	std::string familyName(const ProblemParameters& _parameters);
+	// Semicolon-separated name=value list
+	std::string familyParameters(const ProblemParameters& _parameters);
+	// Whether different seeds give different instances
+	bool isSeeded(const ProblemParameters& _parameters);
+
+	// Inverse of familyName and familyParameters, as "family:name=value;name=value"
+	// Family and parameter names are case sensitive; missing parameters keep their default value
+	ProblemParameters parseProblemParameters(const std::string& _descriptor);
+
+	// The same grid as Problem creates, as an edge list to build the residual graph from directly
+	Graphs::FlowEdgeList createGridEdgeList(const GridParameters& _parameters, unsigned int _seed = 0);
+
+	class Problem final
+	{
+
+	private:
+
+		FlowGraph m_graph;
+		size_t m_source, m_sink;
+
+	public:
+
+		Problem(FlowGraph&& _graph, size_t _source, size_t _sink);
+		Problem(const ProblemParameters& _parameters, unsigned int _seed = 0);
+
+		static Problem readDimacs(std::istream& _stream);
+		static Problem readDimacsFile(const std::string& _file);
+
+		const FlowGraph& graph() const;
+		const FlowVertex& source() const;
+		const FlowVertex& sink() const;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
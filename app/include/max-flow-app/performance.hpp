@@ -2,25 +2,69 @@
 #define INCLUDED_MAX_FLOW_APP_PERFORMANCE
 
 #include <chrono>
+#include <optional>
+#include <array>
+#include <cstdint>
 
 namespace MaxFlow::App
 {
 
+	// User-space hardware event counts, each missing when the event could not be counted
+	struct HardwareCounters final
+	{
+
+		std::optional<std::uint64_t> cycles{};
+		std::optional<std::uint64_t> instructions{};
+		// L1 data cache read misses
+		std::optional<std::uint64_t> l1dMisses{};
+		// Last level cache misses
+		std::optional<std::uint64_t> llcMisses{};
+		std::optional<std::uint64_t> branchMisses{};
+
+		bool any () const;
+
+	};
+
+	// Seconds spent by a single run
+	struct Measurement final
+	{
+
+		double wallTime{};
+		// CPU time of the whole process, so it exceeds the wall time only if the run used several threads
+		double cpuTime{};
+		HardwareCounters counters{};
+
+	};
+
 	class Performance final
 	{
 
 	private:
 
-		Performance () = delete;
-		~Performance () = delete;
+		static constexpr size_t countersCount{ 5 };
 
-		static std::chrono::high_resolution_clock::time_point s_startTime;
+		std::chrono::steady_clock::time_point m_wallStart{};
+		double m_cpuStart{};
+		// perf_event_open group, leader first; -1 for the events that could not be opened
+		std::array<int, countersCount> m_counterFiles;
+		int m_counterGroup{ -1 };
 
 	public:
 
-		static void start ();
+		// Seconds of CPU time used by the process so far
+		static double cpuTime ();
+
+		// Hardware counters are only available on Linux, and only if perf_event_paranoid allows user-space profiling
+		explicit Performance (bool _hardwareCounters = false);
+		Performance (const Performance&) = delete;
+		Performance& operator= (const Performance&) = delete;
+		~Performance ();
+
+		bool hasHardwareCounters () const;
+
+		void start ();
 
-		static double end ();
+		Measurement end () const;
 
 	};
 
@@ -2,6 +2,12 @@
 #define INCLUDED_MAX_FLOW_APP_RANDOM
 
 #include <max-flow/graphs/flow.hpp>
+#include <max-flow/graphs/edge_list.hpp>
+#include <vector>
+#include <span>
+#include <functional>
+#include <ostream>
+#include <string>
 
 namespace MaxFlow::App
 {
@@ -50,6 +56,62 @@ namespace MaxFlow::App
 
 	};
 
+	// Generates instances like RandomProblem's without holding them in memory
+	// The vertices are split into chunks of _chunkSize vertices, each with its own edges count and its own seed derived from the seed and the chunk index,
+	// so that the output depends on the chunk size but not on the threads count
+	// Capacities are scaled by the largest value the distribution can take rather than by the largest value drawn, so the instances differ from RandomProblem's for the same seed
+	class RandomGenerator final
+	{
+
+	public:
+
+		struct Arc final
+		{
+
+			size_t from{}, to{};
+			Graphs::flow_t capacity{};
+
+		};
+
+		using Consumer = std::function<void(std::span<const Arc>)>;
+
+		static constexpr size_t defaultChunkSize{ 1 << 12 };
+
+	private:
+
+		const RandomParameters m_parameters;
+		const unsigned int m_seed;
+		const size_t m_chunkSize;
+		std::vector<size_t> m_chunkEdgesCounts{};
+
+		std::vector<Arc> generateChunk(size_t _chunk) const;
+		std::vector<Arc> generateExpansion() const;
+
+	public:
+
+		RandomGenerator(const RandomParameters& _parameters = {}, unsigned int _seed = 0, size_t _chunkSize = defaultChunkSize);
+
+		size_t verticesCount() const;
+		size_t edgesCount() const;
+		size_t source() const;
+		size_t sink() const;
+		size_t chunksCount() const;
+
+		// Chunks are generated on _threadsCount threads (0 = hardware concurrency) and passed to _consumer on the calling thread in order
+		void generate(const Consumer& _consumer, unsigned int _threadsCount = 0) const;
+
+		Graphs::FlowEdgeList toEdgeList(unsigned int _threadsCount = 0) const;
+
+		// DIMACS max-flow format, with 1-based vertex indices
+		void writeDimacs(std::ostream& _stream, unsigned int _threadsCount = 0) const;
+		void writeDimacsFile(const std::string& _file, unsigned int _threadsCount = 0) const;
+
+		// Native-endian uint64 values: verticesCount, edgesCount, source, sink, then from, to, capacity for every arc
+		void writeBinary(std::ostream& _stream, unsigned int _threadsCount = 0) const;
+		void writeBinaryFile(const std::string& _file, unsigned int _threadsCount = 0) const;
+
+	};
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef INCLUDED_MAX_FLOW_APP_STATISTICS
+#define INCLUDED_MAX_FLOW_APP_STATISTICS
+
+#include <vector>
+#include <cstddef>
+
+namespace MaxFlow::App
+{
+
+	// Robust summary of repeated timings, which are skewed by occasional slow runs
+	struct SampleStatistics final
+	{
+
+		// Samples further than this many scaled MADs from the median are outliers
+		static constexpr double outlierThreshold{ 3.5 };
+
+		size_t count{};
+		double median{};
+		// Median absolute deviation, scaled by 1.4826 to estimate the standard deviation of normal samples
+		double mad{};
+		double mean{};
+		// Distribution-free 95% confidence interval of the median, from order statistics
+		// Below 6 samples it is the whole sample range, which then covers less than 95%
+		double medianLow{}, medianHigh{};
+
+		bool isOutlier (double _sample) const;
+
+	};
+
+	SampleStatistics computeStatistics (std::vector<double> _samples);
+
+}
+
+#endif
\ No newline at end of file
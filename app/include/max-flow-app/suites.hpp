@@ -0,0 +1,25 @@
+#ifndef INCLUDED_MAX_FLOW_APP_SUITES
+#define INCLUDED_MAX_FLOW_APP_SUITES
+
+#include <max-flow-app/test.hpp>
+#include <max-flow-app/random.hpp>
+#include <vector>
+#include <string>
+
+namespace MaxFlow::App
+{
+
+	// Named benchmark campaign, run as a Test of every solver on every problem
+	struct Suite final
+	{
+		std::string name;
+		std::vector<SolverParameters> solvers;
+		std::vector<RandomParameters> problems;
+	};
+
+	const std::vector<Suite>& suites();
+	const Suite& suite(const std::string& _name);
+
+}
+
+#endif
\ No newline at end of file
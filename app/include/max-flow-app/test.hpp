@@ -3,6 +3,9 @@
 
 #include <max-flow/solve.hpp>
 #include <max-flow-app/random.hpp>
+#include <max-flow-app/families.hpp>
+#include <max-flow-app/performance.hpp>
+#include <max-flow-app/statistics.hpp>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -17,22 +20,48 @@ namespace MaxFlow::App
 	};
 
 
+	struct TestParameters final
+	{
+		unsigned int repetitions{ 10 };
+		unsigned int seed{ 0 };
+		unsigned int seedRepetitions{ 1 };
+		bool skipZeroFlows{ false };
+		// Untimed solves of every problem instance and solver before its timed repetitions
+		unsigned int warmUpRepetitions{ 0 };
+		// Threads checking the flows (0 = hardware concurrency)
+		unsigned int threadsCount{ 0 };
+		// Count hardware events around every solve, see Performance
+		bool hardwareCounters{ false };
+		// Also solve every instance twice through one SolverContext, untimed, and check both flows against the timed solve
+		bool checkSolverContext{ false };
+	};
+
+	std::string solverName(ESolver _solver);
+	// Plus-separated short names, e.g. "DF+RZE"
+	std::string solverFlagsName(ESolverFlags _flags);
+
 	class Test final
 	{
 
 	private:
 
-		std::vector<double> m_data;
-		const std::vector<RandomParameters> m_problems;
+		std::vector<Measurement> m_data;
+		std::vector<Measurement> m_warmUpData;
+		const std::vector<ProblemParameters> m_problems;
 		const std::vector<SolverParameters> m_solvers;
 		const unsigned int m_repetitions;
 		const unsigned int m_seed;
 		const unsigned int m_seedRepetitions;
 		const bool m_skipZeroFlows;
+		const unsigned int m_warmUpRepetitions;
+		const unsigned int m_threadsCount;
+		const bool m_hardwareCounters;
+		const bool m_checkSolverContext;
 
 		size_t index(size_t _problem, size_t _solver, unsigned int _repetition, unsigned int _seedRepetition) const;
+		size_t warmUpIndex(size_t _problem, size_t _solver, unsigned int _warmUpRepetition, unsigned int _seedRepetition) const;
 
-		static double run(const RandomProblem& _problem, const SolverParameters& _parameters, Graphs::flow_t _maxFlowReference);
+		Measurement run(const Problem& _problem, const SolverParameters& _parameters) const;
 
 		void logProgress(size_t _current) const;
 		void logProblem(size_t _current) const;
@@ -42,18 +71,29 @@ namespace MaxFlow::App
 
 	public:
 
+		Test(const std::vector<ProblemParameters>& _problems, const std::vector<SolverParameters>& _solvers, const TestParameters& _parameters);
+		Test(const std::vector<ProblemParameters>& _problems, const std::vector<SolverParameters>& _solvers, unsigned int _repetitions = 10, unsigned int _seed = 0, unsigned int _seedRepetitions = 1, bool _skipZeroFlows = false);
 		Test(const std::vector<RandomParameters>& _problems, const std::vector<SolverParameters>& _solvers, unsigned int _repetitions = 10, unsigned int _seed = 0, unsigned int _seedRepetitions = 1, bool _skipZeroFlows = false);
 
-		const std::vector<RandomParameters> problems() const;
+		const std::vector<ProblemParameters> problems() const;
 		const std::vector<SolverParameters> solvers() const;
 		unsigned int repetitions() const;
 		unsigned int seed() const;
 		unsigned int seedRepetitions() const;
 		bool skipZeroFlows() const;
+		unsigned int warmUpRepetitions() const;
+		unsigned int threadsCount() const;
+		bool hardwareCounters() const;
+		bool checkSolverContext() const;
 
 		void run();
 
+		// Wall time of a timed run
 		double test(size_t _problem = 0, size_t _solver = 0, unsigned int _repetition = 0, unsigned int _seedRepetition = 0) const;
+		const Measurement& measurement(size_t _problem = 0, size_t _solver = 0, unsigned int _repetition = 0, unsigned int _seedRepetition = 0) const;
+		const Measurement& warmUpMeasurement(size_t _problem = 0, size_t _solver = 0, unsigned int _warmUpRepetition = 0, unsigned int _seedRepetition = 0) const;
+		// Wall times of the timed runs of a solver on a problem instance
+		SampleStatistics statistics(size_t _problem = 0, size_t _solver = 0, unsigned int _seedRepetition = 0) const;
 
 		std::string toCsv() const;
 		void toCsvFile(const std::string& _file) const;
@@ -2,6 +2,7 @@
 #define INCLUDED_MAX_FLOW_APP_VERIFY
 
 #include <max-flow/graphs/flow.hpp>
+#include <string>
 
 namespace MaxFlow::App
 {
@@ -10,9 +11,33 @@ namespace MaxFlow::App
 	using FlowVertex = FlowGraph::Vertex;
 	using FlowEdge = FlowGraph::Edge;
 
+	struct FlowCheck final
+	{
+
+		enum class EViolation
+		{
+			None, Capacity, Conservation, Terminals
+		};
+
+		EViolation violation{ EViolation::None };
+		size_t vertex{};
+		Graphs::flow_t flow{};
+
+		bool isFlow () const;
+		std::string toString () const;
+
+	};
+
+	// Single pass over the edges, split by vertex ranges across _threadsCount threads (0 = hardware concurrency).
+	// Reports the violation at the lowest vertex index, or the flow value.
+	FlowCheck checkFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, unsigned int _threadsCount = 0);
 	bool isFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink);
 	bool isMaxFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink);
 	bool isMaxFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, Graphs::flow_t _maxFlow);
+	// Whether the sink is unreachable in the residual graph and the cut around the vertices reachable from the source has capacity _flow
+	// For a valid flow of value _flow, this certifies that it is maximum
+	bool isCutSaturated (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, Graphs::flow_t _flow);
+	bool isSinkReachable (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink);
 	void ensureFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink);
 	void ensureMaxFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink);
 	void ensureMaxFlow (const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, Graphs::flow_t _maxFlow);
@@ -0,0 +1,348 @@
+#include <max-flow-app/cli.hpp>
+
+#include <max-flow-app/suites.hpp>
+#include <stdexcept>
+#include <algorithm>
+#include <sstream>
+#include <fstream>
+#include <array>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace MaxFlow::App
+{
+
+	namespace
+	{
+
+		struct SolverFlagName final
+		{
+			std::string_view name;
+			ESolverFlags flag;
+		};
+
+		// Same names as solverFlagsName
+		constexpr std::array<SolverFlagName, 8> solverFlagNames{ {
+			{ "RZE", ESolverFlags::RemoveZeroEdgeLabels },
+			{ "RDE", ESolverFlags::CapacityScalingRemoveDeltaEdges },
+			{ "DMC", ESolverFlags::ShortestPathDetectMinCut },
+			{ "DF", ESolverFlags::FordFulkersonDepthFirst },
+			{ "WAVE", ESolverFlags::DischargeFifoWave },
+			{ "BD", ESolverFlags::FordFulkersonBidirectional },
+			{ "RED", ESolverFlags::ReduceGraph },
+			{ "UNIT", ESolverFlags::DetectUnitCapacities },
+		} };
+
+		constexpr std::array<std::string_view, 6> switches{ "fast", "keep-zero-flows", "counters", "check-context", "help", "list" };
+
+		// Guards against config files including each other
+		constexpr unsigned int maxConfigDepth{ 8 };
+
+		std::vector<ESolver> allSolvers()
+		{
+			std::vector<ESolver> solvers{};
+			for (int s{ 0 }; s <= static_cast<int>(ESolver::CapacityScalingHighestLabelPreflowPush); s++)
+			{
+				solvers.push_back(static_cast<ESolver>(s));
+			}
+			return solvers;
+		}
+
+		template<size_t TIndex = 0>
+		void addDefaultProblemParameters(std::vector<ProblemParameters>& _parameters)
+		{
+			if constexpr (TIndex < std::variant_size_v<ProblemParameters>)
+			{
+				_parameters.emplace_back(std::in_place_index<TIndex>);
+				addDefaultProblemParameters<TIndex + 1>(_parameters);
+			}
+		}
+
+		bool isSwitch(const std::string& _name)
+		{
+			for (const std::string_view name : switches)
+			{
+				if (name == _name)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		unsigned int parseCount(const std::string& _name, const std::string& _value)
+		{
+			std::istringstream ss{ _value };
+			unsigned int value{};
+			if (_value.starts_with('-') || !(ss >> value) || !(ss >> std::ws).eof())
+			{
+				throw std::invalid_argument{ "bad value '" + _value + "' for " + _name };
+			}
+			return value;
+		}
+
+		void parseConfigFile(const std::string& _file, BenchmarkOptions& _options, unsigned int _depth);
+
+		void applyOption(const std::string& _name, const std::string& _value, BenchmarkOptions& _options, unsigned int _depth)
+		{
+			if (_name == "config")
+			{
+				parseConfigFile(_value, _options, _depth + 1);
+			}
+			else if (_name == "suite")
+			{
+				const Suite& suite{ App::suite(_value) };
+				_options.solvers.insert(_options.solvers.end(), suite.solvers.begin(), suite.solvers.end());
+				_options.problems.insert(_options.problems.end(), suite.problems.begin(), suite.problems.end());
+			}
+			else if (_name == "solver")
+			{
+				_options.solvers.push_back(parseSolverParameters(_value));
+			}
+			else if (_name == "problem")
+			{
+				_options.problems.push_back(parseProblemParameters(_value));
+			}
+			else if (_name == "input")
+			{
+				_options.problems.push_back(DimacsParameters{ .file{ _value } });
+			}
+			else if (_name == "repetitions")
+			{
+				_options.test.repetitions = parseCount(_name, _value);
+			}
+			else if (_name == "warm-up")
+			{
+				_options.test.warmUpRepetitions = parseCount(_name, _value);
+			}
+			else if (_name == "seed")
+			{
+				_options.test.seed = parseCount(_name, _value);
+			}
+			else if (_name == "seed-repetitions")
+			{
+				_options.test.seedRepetitions = parseCount(_name, _value);
+			}
+			else if (_name == "threads")
+			{
+				_options.test.threadsCount = parseCount(_name, _value);
+			}
+			else if (_name == "output")
+			{
+				_options.output = _value;
+			}
+			else if (_name == "generate")
+			{
+				_options.generate = _value;
+			}
+			else if (_name == "fast")
+			{
+				_options.test.repetitions = _options.test.seedRepetitions = 1;
+				_options.test.warmUpRepetitions = 0;
+			}
+			else if (_name == "keep-zero-flows")
+			{
+				_options.test.skipZeroFlows = false;
+			}
+			else if (_name == "counters")
+			{
+				_options.test.hardwareCounters = true;
+			}
+			else if (_name == "check-context")
+			{
+				_options.test.checkSolverContext = true;
+			}
+			else if (_name == "help")
+			{
+				_options.help = true;
+			}
+			else if (_name == "list")
+			{
+				_options.list = true;
+			}
+			else
+			{
+				throw std::invalid_argument{ "unknown option '" + _name + "'" };
+			}
+		}
+
+		void parseConfigFile(const std::string& _file, BenchmarkOptions& _options, unsigned int _depth)
+		{
+			if (_depth > maxConfigDepth)
+			{
+				throw std::invalid_argument{ "config files nested too deeply" };
+			}
+			std::ifstream file{ _file };
+			if (!file)
+			{
+				throw std::invalid_argument{ "cannot open '" + _file + "'" };
+			}
+			std::string line{};
+			while (std::getline(file, line))
+			{
+				line = line.substr(0, line.find('#'));
+				const size_t begin{ line.find_first_not_of(" \t\r") };
+				if (begin == std::string::npos)
+				{
+					continue;
+				}
+				const size_t end{ line.find_last_not_of(" \t\r") + 1 };
+				const size_t nameEnd{ std::min(line.find_first_of(" \t=", begin), end) };
+				const std::string name{ line.substr(begin, nameEnd - begin) };
+				size_t valueBegin{ line.find_first_not_of(" \t", nameEnd) };
+				if (valueBegin != std::string::npos && valueBegin < end && line[valueBegin] == '=')
+				{
+					valueBegin = line.find_first_not_of(" \t", valueBegin + 1);
+				}
+				const std::string value{ valueBegin != std::string::npos && valueBegin < end ? line.substr(valueBegin, end - valueBegin) : "" };
+				if (isSwitch(name) != value.empty())
+				{
+					throw std::invalid_argument{ _file + ": bad line '" + line.substr(begin, end - begin) + "'" };
+				}
+				applyOption(name, value, _options, _depth);
+			}
+		}
+
+	}
+
+	ESolverFlags parseSolverFlags(const std::string& _names)
+	{
+		ESolverFlags flags{ ESolverFlags::None };
+		std::istringstream ss{ _names };
+		std::string name{};
+		while (std::getline(ss, name, '+'))
+		{
+			bool found{ false };
+			for (const SolverFlagName& flagName : solverFlagNames)
+			{
+				if (flagName.name == name)
+				{
+					flags = flags + flagName.flag;
+					found = true;
+				}
+			}
+			if (!found)
+			{
+				throw std::invalid_argument{ "unknown solver flag '" + name + "'" };
+			}
+		}
+		return flags;
+	}
+
+	SolverParameters parseSolverParameters(const std::string& _descriptor)
+	{
+		const size_t colon{ _descriptor.find(':') };
+		const std::string name{ _descriptor.substr(0, colon) };
+		for (const ESolver solver : allSolvers())
+		{
+			if (solverName(solver) == name)
+			{
+				return { .solver{ solver }, .flags{ colon == std::string::npos ? ESolverFlags::None : parseSolverFlags(_descriptor.substr(colon + 1)) } };
+			}
+		}
+		throw std::invalid_argument{ "unknown solver '" + name + "'" };
+	}
+
+	void parseArguments(const std::vector<std::string>& _arguments, BenchmarkOptions& _options)
+	{
+		for (size_t a{ 0 }; a < _arguments.size(); a++)
+		{
+			const std::string& argument{ _arguments[a] };
+			if (!argument.starts_with("--"))
+			{
+				throw std::invalid_argument{ "unexpected argument '" + argument + "'" };
+			}
+			const size_t equals{ argument.find('=') };
+			const std::string name{ argument.substr(2, equals == std::string::npos ? std::string::npos : equals - 2) };
+			if (equals != std::string::npos)
+			{
+				if (isSwitch(name))
+				{
+					throw std::invalid_argument{ "unexpected value for '--" + name + "'" };
+				}
+				applyOption(name, argument.substr(equals + 1), _options, 0);
+			}
+			else if (isSwitch(name))
+			{
+				applyOption(name, "", _options, 0);
+			}
+			else if (a + 1 < _arguments.size())
+			{
+				applyOption(name, _arguments[++a], _options, 0);
+			}
+			else
+			{
+				throw std::invalid_argument{ "missing value for '" + argument + "'" };
+			}
+		}
+	}
+
+	void parseConfigFile(const std::string& _file, BenchmarkOptions& _options)
+	{
+		parseConfigFile(_file, _options, 0);
+	}
+
+	BenchmarkOptions parseCommandLine(int _argc, const char* const* _argv)
+	{
+		BenchmarkOptions options{};
+		parseArguments(std::vector<std::string>{ _argv + std::min(_argc, 1), _argv + _argc }, options);
+		return options;
+	}
+
+	std::string usage(const std::string& _program)
+	{
+		std::stringstream ss{};
+		ss << "Usage: " << _program << " [options]" << std::endl;
+		ss << "Runs every solver on every problem and writes the timings as CSV." << std::endl;
+		ss << std::endl;
+		ss << "  --config FILE              read options from FILE, one \"name value\" per line" << std::endl;
+		ss << "  --suite NAME               add the solvers and problems of a predefined suite" << std::endl;
+		ss << "  --solver SOLVER[:FLAGS]    add a solver, with plus-separated flags (e.g. FordFulkerson:DF+RZE)" << std::endl;
+		ss << "  --problem FAMILY[:PARAMS]  add a generated problem (e.g. \"Random:verticesCount=1000;edgesCount=5000\")" << std::endl;
+		ss << "  --input FILE               add a problem read from a DIMACS max-flow file" << std::endl;
+		ss << "  --repetitions N            timed runs per problem instance and solver (default 5)" << std::endl;
+		ss << "  --warm-up N                untimed runs before the timed ones (default 0)" << std::endl;
+		ss << "  --seed N                   first seed (default 0)" << std::endl;
+		ss << "  --seed-repetitions N       instances per problem, with consecutive seeds (default 5)" << std::endl;
+		ss << "  --keep-zero-flows          keep instances with no path to the sink instead of trying the next seed" << std::endl;
+		ss << "  --threads N                threads checking the flows, or generating them with --generate (default 0, all cores)" << std::endl;
+		ss << "  --counters                 count cycles, instructions, cache and branch misses of every solve (Linux)" << std::endl;
+		ss << "  --check-context            also solve every instance twice through one SolverContext and check both flows" << std::endl;
+		ss << "  --output FILE              CSV file (default benchmark.csv)" << std::endl;
+		ss << "  --generate FILE            stream the single Random problem, at the first seed, to FILE (.bin: binary, else DIMACS) instead of solving" << std::endl;
+		ss << "  --fast                     one repetition, one seed and no warm-up" << std::endl;
+		ss << "  --list                     list suites, solvers, flags and problem families" << std::endl;
+		ss << "  --help                     show this help" << std::endl;
+		return ss.str();
+	}
+
+	std::string catalog()
+	{
+		std::stringstream ss{};
+		ss << "Suites:" << std::endl;
+		for (const Suite& suite : suites())
+		{
+			ss << "  " << suite.name << " (" << suite.solvers.size() << " solvers, " << suite.problems.size() << " problems)" << std::endl;
+		}
+		ss << "Solvers:" << std::endl;
+		for (const ESolver solver : allSolvers())
+		{
+			ss << "  " << solverName(solver) << std::endl;
+		}
+		ss << "Solver flags:" << std::endl;
+		for (const SolverFlagName& flagName : solverFlagNames)
+		{
+			ss << "  " << flagName.name << std::endl;
+		}
+		ss << "Problem families, with their default parameters:" << std::endl;
+		std::vector<ProblemParameters> families{};
+		addDefaultProblemParameters(families);
+		for (const ProblemParameters& family : families)
+		{
+			ss << "  " << familyName(family) << ':' << familyParameters(family) << std::endl;
+		}
+		return ss.str();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,895 @@
+#include <max-flow-app/families.hpp>
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <fstream>
+#include <type_traits>
+#include <span>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include <tuple>
+
+using MaxFlow::Graphs::flow_t;
+
+namespace MaxFlow::App
+{
+
+	void GenrmfParameters::validate() const
+	{
+		if (frameSize < 1)
+		{
+			throw std::logic_error{ "frameSize < 1" };
+		}
+		if (framesCount < 1 || frameSize * frameSize * framesCount < 2)
+		{
+			throw std::logic_error{ "less than 2 vertices" };
+		}
+		if (minCapacity < 1 || minCapacity > maxCapacity)
+		{
+			throw std::logic_error{ "capacities not in [1,maxCapacity]" };
+		}
+	}
+
+	size_t GenrmfParameters::verticesCount() const
+	{
+		return frameSize * frameSize * framesCount;
+	}
+
+	size_t GenrmfParameters::edgesCount() const
+	{
+		return 4 * frameSize * (frameSize - 1) * framesCount + frameSize * frameSize * (framesCount - 1);
+	}
+
+	void WashingtonParameters::validate() const
+	{
+		if (rows < 1 || columns < 1)
+		{
+			throw std::logic_error{ "empty grid" };
+		}
+		if (degree < 1 || degree > rows)
+		{
+			throw std::logic_error{ "degree not in [1,rows]" };
+		}
+		if (maxCapacity < 1)
+		{
+			throw std::logic_error{ "maxCapacity < 1" };
+		}
+	}
+
+	size_t WashingtonParameters::verticesCount() const
+	{
+		return rows * columns + 2;
+	}
+
+	size_t WashingtonParameters::edgesCount() const
+	{
+		return rows * (columns - 1) * degree + 2 * rows;
+	}
+
+	void AkParameters::validate() const
+	{
+		if (length < 1)
+		{
+			throw std::logic_error{ "length < 1" };
+		}
+	}
+
+	size_t AkParameters::verticesCount() const
+	{
+		return 3 * length + 2;
+	}
+
+	size_t AkParameters::edgesCount() const
+	{
+		return 5 * length;
+	}
+
+	void BipartiteParameters::validate() const
+	{
+		if (leftCount < 1 || rightCount < 1)
+		{
+			throw std::logic_error{ "empty side" };
+		}
+		if (degree < 1 || degree > rightCount)
+		{
+			throw std::logic_error{ "degree not in [1,rightCount]" };
+		}
+		if (maxCapacity < 1)
+		{
+			throw std::logic_error{ "maxCapacity < 1" };
+		}
+	}
+
+	size_t BipartiteParameters::verticesCount() const
+	{
+		return leftCount + rightCount + 2;
+	}
+
+	size_t BipartiteParameters::edgesCount() const
+	{
+		return leftCount * degree + leftCount + rightCount;
+	}
+
+	void DimacsParameters::validate() const
+	{
+		if (file.empty())
+		{
+			throw std::logic_error{ "empty file name" };
+		}
+	}
+
+	namespace
+	{
+
+		struct GridOffset final
+		{
+
+			long long x, y, z;
+			double distance;
+
+		};
+
+		// The lexicographically positive half of the neighborhood
+		std::vector<GridOffset> gridOffsets(const GridParameters& _parameters)
+		{
+			const bool flat{ _parameters.depth == 1 };
+			const int maxNorm{ _parameters.connectivity == 4 || _parameters.connectivity == 6 ? 1 : _parameters.connectivity == 26 ? 3 : 2 };
+			std::vector<GridOffset> offsets{};
+			for (int z{ 0 }; z <= (flat ? 0 : 1); z++)
+			{
+				for (int y{ z ? -1 : 0 }; y <= 1; y++)
+				{
+					for (int x{ z || y ? -1 : 1 }; x <= 1; x++)
+					{
+						const int norm{ std::abs(x) + std::abs(y) + z };
+						if (norm <= maxNorm)
+						{
+							offsets.push_back({ .x{ x }, .y{ y }, .z{ z }, .distance{ std::sqrt(static_cast<double>(norm)) } });
+						}
+					}
+				}
+			}
+			return offsets;
+		}
+
+	}
+
+	void GridParameters::validate() const
+	{
+		if (width < 1 || height < 1 || depth < 1)
+		{
+			throw std::logic_error{ "empty grid" };
+		}
+		if (depth == 1 ? connectivity != 4 && connectivity != 8 : connectivity != 6 && connectivity != 18 && connectivity != 26)
+		{
+			throw std::logic_error{ "connectivity not in {4,8} for 2D or {6,18,26} for 3D grids" };
+		}
+		if (maxCapacity < 1 || maxTerminalCapacity < 1)
+		{
+			throw std::logic_error{ "maxCapacity < 1" };
+		}
+		if (terminalDensity < 0 || terminalDensity > 1)
+		{
+			throw std::logic_error{ "terminalDensity not in [0,1]" };
+		}
+		if (regionsCount < 1)
+		{
+			throw std::logic_error{ "regionsCount < 1" };
+		}
+		if (noise < 0 || contrastSigma <= 0)
+		{
+			throw std::logic_error{ "noise < 0 or contrastSigma <= 0" };
+		}
+	}
+
+	size_t GridParameters::verticesCount() const
+	{
+		return width * height * depth + 2;
+	}
+
+	size_t GridParameters::edgesCount() const
+	{
+		size_t pairsCount{};
+		for (const GridOffset& offset : gridOffsets(*this))
+		{
+			const size_t dx{ static_cast<size_t>(std::abs(offset.x)) }, dy{ static_cast<size_t>(std::abs(offset.y)) }, dz{ static_cast<size_t>(offset.z) };
+			if (dx < width && dy < height && dz < depth)
+			{
+				pairsCount += (width - dx) * (height - dy) * (depth - dz);
+			}
+		}
+		return 2 * pairsCount + terminalEdgesCount();
+	}
+
+	size_t GridParameters::terminalEdgesCount() const
+	{
+		return static_cast<size_t>(std::round(terminalDensity * width * height * depth));
+	}
+
+	namespace
+	{
+
+		// Picks _count distinct values in [0,_range) by a partial Fisher-Yates shuffle of _values, which must hold a permutation of [0,_range)
+		std::span<const size_t> pickDistinct(std::vector<size_t>& _values, size_t _count, std::mt19937& _generator)
+		{
+			for (size_t i{}; i < _count; i++)
+			{
+				std::uniform_int_distribution<size_t> distribution{ i, _values.size() - 1 };
+				std::swap(_values[i], _values[distribution(_generator)]);
+			}
+			return { _values.data(), _count };
+		}
+
+		FlowGraph createGraph(const GenrmfParameters& _parameters, unsigned int _seed)
+		{
+			_parameters.validate();
+			std::mt19937 generator{ _seed };
+			const size_t a{ _parameters.frameSize }, frameVerticesCount{ a * a };
+			const flow_t frameCapacity{ _parameters.maxCapacity * frameVerticesCount };
+			FlowGraph graph{};
+			graph.addVertices(_parameters.verticesCount());
+			Graphs::FlowGraphBuilder<> builder{ graph };
+			builder.reserve(_parameters.edgesCount());
+			std::uniform_int_distribution<flow_t> capacityDistribution{ _parameters.minCapacity, _parameters.maxCapacity };
+			std::vector<size_t> permutation(frameVerticesCount);
+			for (size_t f{}; f < _parameters.framesCount; f++)
+			{
+				const size_t frame{ f * frameVerticesCount };
+				for (size_t r{}; r < a; r++)
+				{
+					for (size_t c{}; c < a; c++)
+					{
+						const size_t v{ frame + r * a + c };
+						if (r > 0)
+						{
+							builder.addEdge(v, v - a, { frameCapacity });
+						}
+						if (r + 1 < a)
+						{
+							builder.addEdge(v, v + a, { frameCapacity });
+						}
+						if (c > 0)
+						{
+							builder.addEdge(v, v - 1, { frameCapacity });
+						}
+						if (c + 1 < a)
+						{
+							builder.addEdge(v, v + 1, { frameCapacity });
+						}
+					}
+				}
+				if (f + 1 < _parameters.framesCount)
+				{
+					std::iota(permutation.begin(), permutation.end(), 0);
+					std::shuffle(permutation.begin(), permutation.end(), generator);
+					for (size_t i{}; i < frameVerticesCount; i++)
+					{
+						builder.addEdge(frame + i, frame + frameVerticesCount + permutation[i], { capacityDistribution(generator) });
+					}
+				}
+			}
+			builder.build();
+			return graph;
+		}
+
+		FlowGraph createGraph(const WashingtonParameters& _parameters, unsigned int _seed)
+		{
+			_parameters.validate();
+			std::mt19937 generator{ _seed };
+			const size_t rows{ _parameters.rows }, source{ 0 }, sink{ _parameters.verticesCount() - 1 };
+			const flow_t terminalCapacity{ _parameters.maxCapacity * _parameters.degree };
+			const auto vertex{ [rows](size_t _row, size_t _column) { return 1 + _column * rows + _row; } };
+			FlowGraph graph{};
+			graph.addVertices(_parameters.verticesCount());
+			Graphs::FlowGraphBuilder<> builder{ graph };
+			builder.reserve(_parameters.edgesCount());
+			std::uniform_int_distribution<flow_t> capacityDistribution{ 1, _parameters.maxCapacity };
+			std::vector<size_t> nextRows(rows);
+			std::iota(nextRows.begin(), nextRows.end(), 0);
+			for (size_t r{}; r < rows; r++)
+			{
+				builder.addEdge(source, vertex(r, 0), { terminalCapacity });
+			}
+			for (size_t c{}; c + 1 < _parameters.columns; c++)
+			{
+				for (size_t r{}; r < rows; r++)
+				{
+					for (const size_t next : pickDistinct(nextRows, _parameters.degree, generator))
+					{
+						builder.addEdge(vertex(r, c), vertex(next, c + 1), { capacityDistribution(generator) });
+					}
+				}
+			}
+			for (size_t r{}; r < rows; r++)
+			{
+				builder.addEdge(vertex(r, _parameters.columns - 1), sink, { terminalCapacity });
+			}
+			builder.build();
+			return graph;
+		}
+
+		// The source feeds two paths of the given length:
+		// - the first path loses one unit to the sink at every vertex, with the path capacities shrinking accordingly;
+		// - the second path loses one unit at every vertex into a third path, which reaches the sink only at its end.
+		FlowGraph createGraph(const AkParameters& _parameters, unsigned int)
+		{
+			_parameters.validate();
+			const size_t k{ _parameters.length }, source{ 0 }, sink{ _parameters.verticesCount() - 1 };
+			const auto first{ [](size_t _i) { return 1 + _i; } };
+			const auto second{ [k](size_t _i) { return 1 + k + _i; } };
+			const auto third{ [k](size_t _i) { return 1 + 2 * k + _i; } };
+			FlowGraph graph{};
+			graph.addVertices(_parameters.verticesCount());
+			Graphs::FlowGraphBuilder<> builder{ graph };
+			builder.reserve(_parameters.edgesCount());
+			builder.addEdge(source, first(0), { k });
+			builder.addEdge(source, second(0), { k });
+			for (size_t i{}; i < k; i++)
+			{
+				builder.addEdge(first(i), sink, { 1 });
+				builder.addEdge(second(i), third(i), { 1 });
+				if (i + 1 < k)
+				{
+					builder.addEdge(first(i), first(i + 1), { k - i - 1 });
+					builder.addEdge(second(i), second(i + 1), { k - i - 1 });
+					builder.addEdge(third(i), third(i + 1), { k });
+				}
+			}
+			builder.addEdge(third(k - 1), sink, { k });
+			builder.build();
+			return graph;
+		}
+
+		FlowGraph createGraph(const BipartiteParameters& _parameters, unsigned int _seed)
+		{
+			_parameters.validate();
+			std::mt19937 generator{ _seed };
+			const size_t source{ 0 }, sink{ _parameters.verticesCount() - 1 };
+			const auto left{ [](size_t _i) { return 1 + _i; } };
+			const auto right{ [&_parameters](size_t _i) { return 1 + _parameters.leftCount + _i; } };
+			FlowGraph graph{};
+			graph.addVertices(_parameters.verticesCount());
+			Graphs::FlowGraphBuilder<> builder{ graph };
+			builder.reserve(_parameters.edgesCount());
+			std::uniform_int_distribution<flow_t> capacityDistribution{ 1, _parameters.maxCapacity };
+			std::vector<size_t> rights(_parameters.rightCount);
+			std::iota(rights.begin(), rights.end(), 0);
+			for (size_t l{}; l < _parameters.leftCount; l++)
+			{
+				builder.addEdge(source, left(l), { _parameters.maxCapacity });
+				for (const size_t r : pickDistinct(rights, _parameters.degree, generator))
+				{
+					builder.addEdge(left(l), right(r), { capacityDistribution(generator) });
+				}
+			}
+			for (size_t r{}; r < _parameters.rightCount; r++)
+			{
+				builder.addEdge(right(r), sink, { _parameters.maxCapacity });
+			}
+			builder.build();
+			return graph;
+		}
+
+		template<typename TAddEdge>
+		void generateGrid(const GridParameters& _parameters, unsigned int _seed, const TAddEdge& _addEdge)
+		{
+			_parameters.validate();
+			std::mt19937 generator{ _seed };
+			const size_t width{ _parameters.width }, height{ _parameters.height }, depth{ _parameters.depth };
+			const size_t pixelsCount{ width * height * depth }, source{ 0 }, sink{ pixelsCount + 1 };
+			const auto pixel{ [=](size_t _x, size_t _y, size_t _z) { return (_z * height + _y) * width + _x; } };
+			// Synthetic image
+			std::vector<double> intensities(pixelsCount);
+			{
+				struct Region final
+				{
+					double x, y, z, intensity;
+				};
+				std::uniform_real_distribution<double> unitDistribution{ 0, 1 };
+				std::normal_distribution<double> noiseDistribution{ 0, _parameters.noise };
+				std::vector<Region> regions(_parameters.regionsCount);
+				for (Region& region : regions)
+				{
+					region = { unitDistribution(generator) * width, unitDistribution(generator) * height, unitDistribution(generator) * depth, unitDistribution(generator) };
+				}
+				for (size_t z{}; z < depth; z++)
+				{
+					for (size_t y{}; y < height; y++)
+					{
+						for (size_t x{}; x < width; x++)
+						{
+							const auto distance{ [&](const Region& _region) { return std::pow(_region.x - x, 2) + std::pow(_region.y - y, 2) + std::pow(_region.z - z, 2); } };
+							const Region& nearest{ *std::min_element(regions.begin(), regions.end(), [&](const Region& _a, const Region& _b) { return distance(_a) < distance(_b); }) };
+							intensities[pixel(x, y, z)] = nearest.intensity + noiseDistribution(generator);
+						}
+					}
+				}
+			}
+			// Neighbor arcs, the same capacity in both directions
+			{
+				std::uniform_int_distribution<flow_t> capacityDistribution{ 1, _parameters.maxCapacity };
+				const std::vector<GridOffset> offsets{ gridOffsets(_parameters) };
+				for (size_t z{}; z < depth; z++)
+				{
+					for (size_t y{}; y < height; y++)
+					{
+						for (size_t x{}; x < width; x++)
+						{
+							const size_t p{ pixel(x, y, z) };
+							for (const GridOffset& offset : offsets)
+							{
+								const long long nx{ static_cast<long long>(x) + offset.x }, ny{ static_cast<long long>(y) + offset.y }, nz{ static_cast<long long>(z) + offset.z };
+								if (nx < 0 || ny < 0 || nx >= static_cast<long long>(width) || ny >= static_cast<long long>(height) || nz >= static_cast<long long>(depth))
+								{
+									continue;
+								}
+								const size_t q{ pixel(static_cast<size_t>(nx), static_cast<size_t>(ny), static_cast<size_t>(nz)) };
+								flow_t capacity;
+								if (_parameters.capacities == GridParameters::ECapacities::Uniform)
+								{
+									capacity = capacityDistribution(generator);
+								}
+								else
+								{
+									const double difference{ intensities[p] - intensities[q] };
+									const double weight{ std::exp(-difference * difference / (2 * _parameters.contrastSigma * _parameters.contrastSigma)) / offset.distance };
+									capacity = std::clamp<flow_t>(static_cast<flow_t>(std::round(weight * _parameters.maxCapacity)), 1, _parameters.maxCapacity);
+								}
+								_addEdge(1 + p, 1 + q, capacity);
+								_addEdge(1 + q, 1 + p, capacity);
+							}
+						}
+					}
+				}
+			}
+			// Terminal arcs on a random subset of the pixels
+			{
+				std::vector<size_t> pixels(pixelsCount);
+				std::iota(pixels.begin(), pixels.end(), 0);
+				std::span<const size_t> terminalPixels{ pickDistinct(pixels, _parameters.terminalEdgesCount(), generator) };
+				std::vector<size_t> sortedTerminalPixels{ terminalPixels.begin(), terminalPixels.end() };
+				std::sort(sortedTerminalPixels.begin(), sortedTerminalPixels.end());
+				for (const size_t p : sortedTerminalPixels)
+				{
+					const double cost{ intensities[p] - 0.5 };
+					const flow_t capacity{ std::clamp<flow_t>(static_cast<flow_t>(std::round(std::abs(cost) * 2 * _parameters.maxTerminalCapacity)), 1, _parameters.maxTerminalCapacity) };
+					if (cost >= 0)
+					{
+						_addEdge(source, 1 + p, capacity);
+					}
+					else
+					{
+						_addEdge(1 + p, sink, capacity);
+					}
+				}
+			}
+		}
+
+		FlowGraph createGraph(const GridParameters& _parameters, unsigned int _seed)
+		{
+			FlowGraph graph{};
+			graph.addVertices(_parameters.verticesCount());
+			Graphs::FlowGraphBuilder<> builder{ graph };
+			builder.reserve(_parameters.edgesCount());
+			generateGrid(_parameters, _seed, [&](size_t _from, size_t _to, flow_t _capacity) {
+				builder.addEdge(_from, _to, { _capacity });
+			});
+			builder.build();
+			return graph;
+		}
+
+		FlowGraph createGraph(const RandomParameters& _parameters, unsigned int _seed)
+		{
+			RandomProblem problem{ _parameters, _seed };
+			return std::move(problem.graph());
+		}
+
+	}
+
+	std::string familyName(const ProblemParameters& _parameters)
+	{
+		switch (_parameters.index())
+		{
+		case 0:
+			return "Random";
+		case 1:
+			return "Genrmf";
+		case 2:
+			return "Washington";
+		case 3:
+			return "Ak";
+		case 4:
+			return "Bipartite";
+		case 5:
+			return "Grid";
+		case 6:
+			return "Dimacs";
+		default:
+			throw std::invalid_argument{ "unknown family" };
+		}
+	}
+
+	std::string familyParameters(const ProblemParameters& _parameters)
+	{
+		std::stringstream ss{};
+		std::visit([&](const auto& _family) {
+			using TFamily = std::decay_t<decltype(_family)>;
+			if constexpr (std::is_same_v<TFamily, RandomParameters>)
+			{
+				ss << "maxCapacity=" << _family.maxCapacity << ";verticesCount=" << _family.verticesCount << ";edgesCount=" << _family.edgesCount;
+				ss << ";expand=" << _family.expand << ";backwardsEdgeDensityFactor=" << _family.backwardsEdgeDensityFactor << ";capacityDeviance=" << _family.capacityDeviance;
+			}
+			else if constexpr (std::is_same_v<TFamily, GenrmfParameters>)
+			{
+				ss << "frameSize=" << _family.frameSize << ";framesCount=" << _family.framesCount << ";minCapacity=" << _family.minCapacity << ";maxCapacity=" << _family.maxCapacity;
+			}
+			else if constexpr (std::is_same_v<TFamily, WashingtonParameters>)
+			{
+				ss << "rows=" << _family.rows << ";columns=" << _family.columns << ";degree=" << _family.degree << ";maxCapacity=" << _family.maxCapacity;
+			}
+			else if constexpr (std::is_same_v<TFamily, AkParameters>)
+			{
+				ss << "length=" << _family.length;
+			}
+			else if constexpr (std::is_same_v<TFamily, GridParameters>)
+			{
+				ss << "width=" << _family.width << ";height=" << _family.height << ";depth=" << _family.depth << ";connectivity=" << _family.connectivity;
+				ss << ";capacities=" << (_family.capacities == GridParameters::ECapacities::Uniform ? "Uniform" : "Contrast") << ";maxCapacity=" << _family.maxCapacity;
+				ss << ";maxTerminalCapacity=" << _family.maxTerminalCapacity << ";terminalDensity=" << _family.terminalDensity;
+				ss << ";regionsCount=" << _family.regionsCount << ";noise=" << _family.noise << ";contrastSigma=" << _family.contrastSigma;
+			}
+			else if constexpr (std::is_same_v<TFamily, DimacsParameters>)
+			{
+				ss << "file=" << _family.file;
+			}
+			else
+			{
+				ss << "leftCount=" << _family.leftCount << ";rightCount=" << _family.rightCount << ";degree=" << _family.degree << ";maxCapacity=" << _family.maxCapacity;
+			}
+		}, _parameters);
+		return ss.str();
+	}
+
+	bool isSeeded(const ProblemParameters& _parameters)
+	{
+		return !std::holds_alternative<AkParameters>(_parameters) && !std::holds_alternative<DimacsParameters>(_parameters);
+	}
+
+	namespace
+	{
+
+		template<typename TValue>
+		TValue parseParameterValue(const std::string& _name, const std::string& _value)
+		{
+			if constexpr (std::is_same_v<TValue, std::string>)
+			{
+				return _value;
+			}
+			else if constexpr (std::is_same_v<TValue, GridParameters::ECapacities>)
+			{
+				if (_value == "Uniform")
+				{
+					return GridParameters::ECapacities::Uniform;
+				}
+				if (_value == "Contrast")
+				{
+					return GridParameters::ECapacities::Contrast;
+				}
+				throw std::invalid_argument{ "bad value '" + _value + "' for " + _name };
+			}
+			else
+			{
+				std::istringstream ss{ _value };
+				TValue value{};
+				if ((std::is_unsigned_v<TValue> && _value.starts_with('-')) || !(ss >> value) || !(ss >> std::ws).eof())
+				{
+					throw std::invalid_argument{ "bad value '" + _value + "' for " + _name };
+				}
+				return value;
+			}
+		}
+
+		template<typename TValue>
+		bool setParameter(const std::string& _name, const std::string& _value, std::string_view _key, TValue& _field)
+		{
+			if (_name != _key)
+			{
+				return false;
+			}
+			_field = parseParameterValue<TValue>(_name, _value);
+			return true;
+		}
+
+		bool setParameter(RandomParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "maxCapacity", _family.maxCapacity)
+				|| setParameter(_name, _value, "verticesCount", _family.verticesCount)
+				|| setParameter(_name, _value, "edgesCount", _family.edgesCount)
+				|| setParameter(_name, _value, "expand", _family.expand)
+				|| setParameter(_name, _value, "backwardsEdgeDensityFactor", _family.backwardsEdgeDensityFactor)
+				|| setParameter(_name, _value, "capacityDeviance", _family.capacityDeviance);
+		}
+
+		bool setParameter(GenrmfParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "frameSize", _family.frameSize)
+				|| setParameter(_name, _value, "framesCount", _family.framesCount)
+				|| setParameter(_name, _value, "minCapacity", _family.minCapacity)
+				|| setParameter(_name, _value, "maxCapacity", _family.maxCapacity);
+		}
+
+		bool setParameter(WashingtonParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "rows", _family.rows)
+				|| setParameter(_name, _value, "columns", _family.columns)
+				|| setParameter(_name, _value, "degree", _family.degree)
+				|| setParameter(_name, _value, "maxCapacity", _family.maxCapacity);
+		}
+
+		bool setParameter(AkParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "length", _family.length);
+		}
+
+		bool setParameter(BipartiteParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "leftCount", _family.leftCount)
+				|| setParameter(_name, _value, "rightCount", _family.rightCount)
+				|| setParameter(_name, _value, "degree", _family.degree)
+				|| setParameter(_name, _value, "maxCapacity", _family.maxCapacity);
+		}
+
+		bool setParameter(GridParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "width", _family.width)
+				|| setParameter(_name, _value, "height", _family.height)
+				|| setParameter(_name, _value, "depth", _family.depth)
+				|| setParameter(_name, _value, "connectivity", _family.connectivity)
+				|| setParameter(_name, _value, "capacities", _family.capacities)
+				|| setParameter(_name, _value, "maxCapacity", _family.maxCapacity)
+				|| setParameter(_name, _value, "maxTerminalCapacity", _family.maxTerminalCapacity)
+				|| setParameter(_name, _value, "terminalDensity", _family.terminalDensity)
+				|| setParameter(_name, _value, "regionsCount", _family.regionsCount)
+				|| setParameter(_name, _value, "noise", _family.noise)
+				|| setParameter(_name, _value, "contrastSigma", _family.contrastSigma);
+		}
+
+		bool setParameter(DimacsParameters& _family, const std::string& _name, const std::string& _value)
+		{
+			return setParameter(_name, _value, "file", _family.file);
+		}
+
+		template<size_t TIndex = 0>
+		ProblemParameters defaultProblemParameters(const std::string& _family)
+		{
+			if constexpr (TIndex < std::variant_size_v<ProblemParameters>)
+			{
+				const ProblemParameters parameters{ std::in_place_index<TIndex> };
+				if (familyName(parameters) == _family)
+				{
+					return parameters;
+				}
+				return defaultProblemParameters<TIndex + 1>(_family);
+			}
+			else
+			{
+				throw std::invalid_argument{ "unknown family '" + _family + "'" };
+			}
+		}
+
+	}
+
+	ProblemParameters parseProblemParameters(const std::string& _descriptor)
+	{
+		const size_t colon{ _descriptor.find(':') };
+		ProblemParameters parameters{ defaultProblemParameters(_descriptor.substr(0, colon)) };
+		if (colon != std::string::npos)
+		{
+			std::istringstream ss{ _descriptor.substr(colon + 1) };
+			std::string assignment{};
+			while (std::getline(ss, assignment, ';'))
+			{
+				if (assignment.empty())
+				{
+					continue;
+				}
+				const size_t equals{ assignment.find('=') };
+				if (equals == std::string::npos)
+				{
+					throw std::invalid_argument{ "expected name=value, got '" + assignment + "'" };
+				}
+				const std::string name{ assignment.substr(0, equals) };
+				const bool known{ std::visit([&](auto& _family) { return setParameter(_family, name, assignment.substr(equals + 1)); }, parameters) };
+				if (!known)
+				{
+					throw std::invalid_argument{ "unknown " + familyName(parameters) + " parameter '" + name + "'" };
+				}
+			}
+		}
+		std::visit([](const auto& _family) { _family.validate(); }, parameters);
+		return parameters;
+	}
+
+	Graphs::FlowEdgeList createGridEdgeList(const GridParameters& _parameters, unsigned int _seed)
+	{
+		Graphs::FlowEdgeList edgeList{ _parameters.verticesCount() };
+		edgeList.reserve(_parameters.edgesCount());
+		generateGrid(_parameters, _seed, [&](size_t _from, size_t _to, flow_t _capacity) {
+			edgeList.addEdge(_from, _to, _capacity);
+		});
+		return edgeList;
+	}
+
+	Problem::Problem(FlowGraph&& _graph, size_t _source, size_t _sink)
+		: m_graph{ std::move(_graph) }, m_source{ _source }, m_sink{ _sink }
+	{
+		if (_source >= m_graph.verticesCount() || _sink >= m_graph.verticesCount())
+		{
+			throw std::out_of_range{ "terminal out of range" };
+		}
+	}
+
+	namespace
+	{
+
+		// Generated families put the source first and the sink last
+		template<typename TFamily>
+		Problem createProblem(const TFamily& _family, unsigned int _seed)
+		{
+			FlowGraph graph{ createGraph(_family, _seed) };
+			const size_t sink{ graph.verticesCount() - 1 };
+			return Problem{ std::move(graph), 0, sink };
+		}
+
+		Problem createProblem(const DimacsParameters& _family, unsigned int)
+		{
+			_family.validate();
+			return Problem::readDimacsFile(_family.file);
+		}
+
+	}
+
+	Problem::Problem(const ProblemParameters& _parameters, unsigned int _seed)
+		: Problem{ std::visit([_seed](const auto& _family) { return createProblem(_family, _seed); }, _parameters) }
+	{}
+
+	Problem Problem::readDimacs(std::istream& _stream)
+	{
+		constexpr size_t none{ std::numeric_limits<size_t>::max() };
+		// The header is not trusted beyond this, so a bogus arcs count cannot exhaust memory before the arc lines are read
+		constexpr size_t maxReservedArcs{ size_t{ 1 } << 24 };
+		size_t verticesCount{ none }, source{ none }, sink{ none }, lineNumber{ 0 };
+		std::vector<std::tuple<size_t, size_t, flow_t>> arcs{};
+		std::string line{};
+		const auto fail{ [&](const std::string& _message) {
+			throw std::invalid_argument{ "dimacs line " + std::to_string(lineNumber) + ": " + _message };
+		} };
+		// Unsigned extraction accepts a leading minus and wraps around
+		const auto isNegative{ [](std::istream& _line) {
+			return (_line >> std::ws).peek() == '-';
+		} };
+		const auto readVertex{ [&](std::istream& _line) {
+			size_t vertex{};
+			if (!(_line >> vertex) || vertex < 1 || vertex > verticesCount)
+			{
+				fail("bad vertex");
+			}
+			return vertex - 1;
+		} };
+		while (std::getline(_stream, line))
+		{
+			lineNumber++;
+			std::istringstream ss{ line };
+			char kind{};
+			if (!(ss >> kind) || kind == 'c')
+			{
+				continue;
+			}
+			if (kind != 'p' && verticesCount == none)
+			{
+				fail("missing problem line");
+			}
+			switch (kind)
+			{
+			case 'p':
+			{
+				std::string format{};
+				size_t edgesCount{};
+				if (verticesCount != none || !(ss >> format) || isNegative(ss) || !(ss >> verticesCount) || isNegative(ss) || !(ss >> edgesCount) || format != "max" || verticesCount < 2)
+				{
+					fail("bad problem line");
+				}
+				arcs.reserve(std::min(edgesCount, maxReservedArcs));
+				break;
+			}
+			case 'n':
+			{
+				const size_t vertex{ readVertex(ss) };
+				char role{};
+				ss >> role;
+				if (role == 's' && source == none)
+				{
+					source = vertex;
+				}
+				else if (role == 't' && sink == none)
+				{
+					sink = vertex;
+				}
+				else
+				{
+					fail("bad node line");
+				}
+				break;
+			}
+			case 'a':
+			{
+				const size_t from{ readVertex(ss) }, to{ readVertex(ss) };
+				flow_t capacity{};
+				if (isNegative(ss) || !(ss >> capacity))
+				{
+					fail("bad capacity");
+				}
+				if (from != to && capacity)
+				{
+					arcs.push_back({ from, to, capacity });
+				}
+				break;
+			}
+			default:
+				fail(std::string{ "unknown line kind '" } + kind + "'");
+			}
+		}
+		if (source == none || sink == none || source == sink)
+		{
+			throw std::invalid_argument{ "dimacs: missing or equal terminals" };
+		}
+		std::sort(arcs.begin(), arcs.end());
+		FlowGraph graph{};
+		graph.addVertices(verticesCount);
+		Graphs::FlowGraphBuilder<> builder{ graph };
+		builder.reserve(arcs.size());
+		for (size_t a{ 0 }; a < arcs.size();)
+		{
+			const auto [from, to, capacity] { arcs[a] };
+			flow_t totalCapacity{ capacity };
+			for (a++; a < arcs.size() && std::get<0>(arcs[a]) == from && std::get<1>(arcs[a]) == to; a++)
+			{
+				totalCapacity += std::get<2>(arcs[a]);
+			}
+			builder.addEdge(from, to, { totalCapacity });
+		}
+		builder.build();
+		return Problem{ std::move(graph), source, sink };
+	}
+
+	Problem Problem::readDimacsFile(const std::string& _file)
+	{
+		std::ifstream file{ _file };
+		if (!file)
+		{
+			throw std::invalid_argument{ "cannot open '" + _file + "'" };
+		}
+		return readDimacs(file);
+	}
+
+	const FlowGraph& Problem::graph() const
+	{
+		return m_graph;
+	}
+
+	const FlowVertex& Problem::source() const
+	{
+		return m_graph[m_source];
+	}
+
+	const FlowVertex& Problem::sink() const
+	{
+		return m_graph[m_sink];
+	}
+
+}
\ No newline at end of file
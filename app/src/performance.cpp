@@ -1,23 +1,189 @@
 #include <max-flow-app/performance.hpp>
 
-#include <cmath>
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <ctime>
+#endif
+
+#ifdef __linux__
+#define MF_APP_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
 
 namespace MaxFlow::App
 {
 
-	std::chrono::high_resolution_clock::time_point Performance::s_startTime;
+	namespace
+	{
+
+#ifdef MF_APP_PERF_EVENTS
 
-	void Performance::start ()
+		struct CounterEvent final
+		{
+
+			std::uint32_t type;
+			std::uint64_t config;
+			std::optional<std::uint64_t> HardwareCounters::* pValue;
+
+		};
+
+		constexpr std::uint64_t cacheEvent (std::uint64_t _cache, std::uint64_t _operation, std::uint64_t _result)
+		{
+			return _cache | (_operation << 8) | (_result << 16);
+		}
+
+		// Same order as Performance::m_counterFiles
+		constexpr std::array<CounterEvent, 5> counterEvents{ {
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &HardwareCounters::cycles },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &HardwareCounters::instructions },
+			{ PERF_TYPE_HW_CACHE, cacheEvent (PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), &HardwareCounters::l1dMisses },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &HardwareCounters::llcMisses },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, &HardwareCounters::branchMisses },
+		} };
+
+		int openCounter (const CounterEvent& _event, int _group)
+		{
+			perf_event_attr attributes;
+			std::memset (&attributes, 0, sizeof (attributes));
+			attributes.size = sizeof (attributes);
+			attributes.type = _event.type;
+			attributes.config = _event.config;
+			attributes.disabled = _group == -1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			return static_cast<int>(syscall (SYS_perf_event_open, &attributes, 0, -1, _group, 0));
+		}
+
+		// Scaled up if the group was multiplexed with other events; missing if it never ran
+		std::optional<std::uint64_t> readCounter (int _file)
+		{
+			std::uint64_t values[3]{};
+			if (read (_file, values, sizeof (values)) != sizeof (values) || !values[2])
+			{
+				return std::nullopt;
+			}
+			if (values[2] < values[1])
+			{
+				return static_cast<std::uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+			}
+			return values[0];
+		}
+
+#endif
+
+	}
+
+	bool HardwareCounters::any () const
 	{
-		s_startTime = std::chrono::high_resolution_clock::now ();
+		return cycles || instructions || l1dMisses || llcMisses || branchMisses;
 	}
 
-	double Performance::end ()
+	double Performance::cpuTime ()
 	{
-		const std::chrono::high_resolution_clock::time_point endTime{ std::chrono::high_resolution_clock::now () };
-		return  std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - s_startTime).count () / 1000000000.0 ;
+#ifdef WIN32
+		FILETIME creation, exit, kernel, user;
+		if (!GetProcessTimes (GetCurrentProcess (), &creation, &exit, &kernel, &user))
+		{
+			return 0;
+		}
+		const auto ticks{ [] (const FILETIME& _time) { return (static_cast<unsigned long long>(_time.dwHighDateTime) << 32) | _time.dwLowDateTime; } };
+		// 100 ns ticks
+		return (ticks (kernel) + ticks (user)) / 10000000.0;
+#else
+		timespec time{};
+		if (clock_gettime (CLOCK_PROCESS_CPUTIME_ID, &time))
+		{
+			return 0;
+		}
+		return time.tv_sec + time.tv_nsec / 1000000000.0;
+#endif
 	}
 
+	Performance::Performance (bool _hardwareCounters)
+	{
+		m_counterFiles.fill (-1);
+#ifdef MF_APP_PERF_EVENTS
+		if (_hardwareCounters)
+		{
+			// Events the CPU or the kernel do not support are left out; the first one that opens leads the group
+			for (size_t c{ 0 }; c < countersCount; c++)
+			{
+				m_counterFiles[c] = openCounter (counterEvents[c], m_counterGroup);
+				if (m_counterFiles[c] != -1 && m_counterGroup == -1)
+				{
+					m_counterGroup = m_counterFiles[c];
+				}
+			}
+		}
+#endif
+	}
+
+	Performance::~Performance ()
+	{
+#ifdef MF_APP_PERF_EVENTS
+		for (const int file : m_counterFiles)
+		{
+			if (file != -1)
+			{
+				close (file);
+			}
+		}
+#endif
+	}
+
+	bool Performance::hasHardwareCounters () const
+	{
+		return m_counterGroup != -1;
+	}
 
-}
+	void Performance::start ()
+	{
+#ifdef MF_APP_PERF_EVENTS
+		if (m_counterGroup != -1)
+		{
+			ioctl (m_counterGroup, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		}
+#endif
+		m_cpuStart = cpuTime ();
+		m_wallStart = std::chrono::steady_clock::now ();
+#ifdef MF_APP_PERF_EVENTS
+		if (m_counterGroup != -1)
+		{
+			ioctl (m_counterGroup, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+#endif
+	}
+
+	Measurement Performance::end () const
+	{
+#ifdef MF_APP_PERF_EVENTS
+		if (m_counterGroup != -1)
+		{
+			ioctl (m_counterGroup, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		}
+#endif
+		const std::chrono::steady_clock::time_point wallEnd{ std::chrono::steady_clock::now () };
+		const double cpuEnd{ cpuTime () };
+		Measurement measurement{
+			.wallTime{ std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - m_wallStart).count () / 1000000000.0 },
+			.cpuTime{ cpuEnd - m_cpuStart }
+		};
+#ifdef MF_APP_PERF_EVENTS
+		for (size_t c{ 0 }; c < countersCount; c++)
+		{
+			if (m_counterFiles[c] != -1)
+			{
+				measurement.counters.*counterEvents[c].pValue = readCounter (m_counterFiles[c]);
+			}
+		}
+#endif
+		return measurement;
+	}
 
+}
\ No newline at end of file
@@ -8,6 +8,12 @@
 #include <utility>
 #include <cmath>
 #include <tuple>
+#include <future>
+#include <thread>
+#include <unordered_set>
+#include <fstream>
+#include <charconv>
+#include <cstdint>
 
 #include <iostream>
 
@@ -44,29 +50,29 @@ namespace MaxFlow::App
 		}
 	}
 
-	std::vector<size_t> randomCounts(size_t _verticesCount, size_t _edgesCount, double _backwardsEdgeDensityFactor, unsigned int _seed)
+	// Out-degrees of the _chunkSize vertices starting at _first, summing to _edgesCount
+	std::vector<size_t> randomCounts(size_t _verticesCount, size_t _first, size_t _chunkSize, size_t _edgesCount, double _backwardsEdgeDensityFactor, std::mt19937& _generator)
 	{
-		std::mt19937 generator{ _seed };
-		std::vector<size_t> counts(_verticesCount);
+		std::vector<size_t> counts(_chunkSize);
 		size_t countSum{};
 		{
-			std::vector<double> factors(_verticesCount);
+			std::vector<double> factors(_chunkSize);
 			double sum{};
 			{
 				const std::uniform_real_distribution<double> distribution{ 0, 1 };
-				for (size_t i{}; i < _verticesCount; i++)
+				for (size_t i{}; i < _chunkSize; i++)
 				{
-					const double backwardFactor{ static_cast<double>(i) / (_verticesCount - 1) };
+					const double backwardFactor{ static_cast<double>(_first + i) / (_verticesCount - 1) };
 					const double weight{ _backwardsEdgeDensityFactor * backwardFactor + (1 - backwardFactor) };
-					sum += factors[i] = distribution(generator) * weight;
+					sum += factors[i] = distribution(_generator) * weight;
 				}
 				if (!sum)
 				{
-					std::uniform_int_distribution<size_t> altDistribution{ 0, _verticesCount - 1 };
-					sum = factors[altDistribution(generator)] = 1;
+					std::uniform_int_distribution<size_t> altDistribution{ 0, _chunkSize - 1 };
+					sum = factors[altDistribution(_generator)] = 1;
 				}
 			}
-			for (size_t i{}; i < _verticesCount; i++)
+			for (size_t i{}; i < _chunkSize; i++)
 			{
 				countSum += counts[i] = std::min(_verticesCount - 1, static_cast<size_t>(std::round(factors[i] / sum * _edgesCount)));
 			}
@@ -76,8 +82,8 @@ namespace MaxFlow::App
 			const bool less{ countSum < _edgesCount };
 			auto isTarget{ [less, max = _verticesCount - 1] (size_t _count) {return less ? _count < max : _count > 0; } };
 			std::vector<size_t> targets;
-			targets.reserve(_verticesCount);
-			for (size_t i{}; i < _verticesCount; i++)
+			targets.reserve(_chunkSize);
+			for (size_t i{}; i < _chunkSize; i++)
 			{
 				if (isTarget(counts[i]))
 				{
@@ -87,7 +93,7 @@ namespace MaxFlow::App
 			while (countSum != _edgesCount)
 			{
 				std::uniform_int_distribution<size_t> distribution{ 0, targets.size() - 1 };
-				size_t targetIndex{ distribution(generator) };
+				size_t targetIndex{ distribution(_generator) };
 				size_t& target{ counts[targets[targetIndex]] };
 				if (less)
 				{
@@ -115,6 +121,12 @@ namespace MaxFlow::App
 		return counts;
 	}
 
+	std::vector<size_t> randomCounts(size_t _verticesCount, size_t _edgesCount, double _backwardsEdgeDensityFactor, unsigned int _seed)
+	{
+		std::mt19937 generator{ _seed };
+		return randomCounts(_verticesCount, 0, _verticesCount, _edgesCount, _backwardsEdgeDensityFactor, generator);
+	}
+
 	class Picker final
 	{
 
@@ -211,6 +223,8 @@ namespace MaxFlow::App
 			const std::vector<size_t> counts{ randomCounts(_parameters.verticesCount, _parameters.edgesCount, _parameters.backwardsEdgeDensityFactor, _seed) };
 			Picker forwardPicker{ _parameters.verticesCount - 1 }, backwardPicker{ _parameters.verticesCount - 1 };
 			std::bernoulli_distribution backwardDistribution{ _parameters.backwardsEdgeDensityFactor };
+			Graphs::FlowGraphBuilder<> builder{ m_graph };
+			builder.reserve(_parameters.edgesCount);
 			for (FlowVertex& vertex : m_graph)
 			{
 				forwardPicker.reset(_parameters.verticesCount - vertex.index() - 1);
@@ -226,10 +240,11 @@ namespace MaxFlow::App
 					{
 						to = forwardPicker.pop(generator) + vertex.index() + 1;
 					}
-					const Graphs::flow_t capacity{ std::clamp<Graphs::flow_t>(static_cast<Graphs::flow_t>(std::round(capacities[m_graph.edgesCount()])), 1, _parameters.maxCapacity) };
-					vertex.addOutEdge(to, { capacity });
+					const Graphs::flow_t capacity{ std::clamp<Graphs::flow_t>(static_cast<Graphs::flow_t>(std::round(capacities[builder.edgesCount()])), 1, _parameters.maxCapacity) };
+					builder.addEdge(vertex.index(), to, { capacity });
 				}
 			}
+			builder.build();
 		}
 		expand(_parameters.expand, _parameters.maxCapacity);
 	}
@@ -253,13 +268,10 @@ namespace MaxFlow::App
 				}
 			}
 		}
-		for (size_t i{ sink().index() - 1 }; i > 0; i--)
-		{
-			if (!reached[i])
-			{
-				graph().destroyVertex(i);
-			}
-		}
+		const size_t source{ this->source().index() }, sink{ this->sink().index() };
+		graph().destroyVertices([&](const FlowVertex& _vertex) {
+			return !reached[_vertex.index()] && _vertex.index() != source && _vertex.index() != sink;
+		});
 	}
 
 	const FlowGraph& RandomProblem::graph() const
@@ -304,4 +316,276 @@ namespace MaxFlow::App
 		}
 	}
 
+	namespace
+	{
+
+		Graphs::flow_t randomCapacity(const RandomParameters& _parameters, std::mt19937& _generator)
+		{
+			constexpr double maxExponent{ 3 };
+			const double exponentAbs{ 1 + std::abs(_parameters.capacityDeviance) * (maxExponent - 1) };
+			const double exponent{ _parameters.capacityDeviance < 0 ? exponentAbs : 1 / exponentAbs };
+			const std::uniform_real_distribution<double> distribution{ 0,1 };
+			const double capacity{ std::pow(distribution(_generator), exponent) * (_parameters.maxCapacity - 1) + 1 };
+			return std::clamp<Graphs::flow_t>(static_cast<Graphs::flow_t>(std::round(capacity)), 1, _parameters.maxCapacity);
+		}
+
+		// Floyd's sampling of _count distinct values in [0,_range)
+		template<typename TFunction>
+		void sampleDistinct(size_t _range, size_t _count, std::mt19937& _generator, std::unordered_set<size_t>& _picked, const TFunction& _function)
+		{
+			_picked.clear();
+			for (size_t j{ _range - _count }; j < _range; j++)
+			{
+				std::uniform_int_distribution<size_t> distribution{ 0, j };
+				const size_t value{ distribution(_generator) };
+				const size_t picked{ _picked.contains(value) ? j : value };
+				_picked.insert(picked);
+				_function(picked);
+			}
+		}
+
+		template<typename TValue>
+		void writeRaw(std::ostream& _stream, const TValue& _value)
+		{
+			_stream.write(reinterpret_cast<const char*>(&_value), sizeof(TValue));
+		}
+
+	}
+
+	RandomGenerator::RandomGenerator(const RandomParameters& _parameters, unsigned int _seed, size_t _chunkSize)
+		: m_parameters{ _parameters }, m_seed{ _seed }, m_chunkSize{ _chunkSize }
+	{
+		_parameters.validate();
+		if (!_chunkSize)
+		{
+			throw std::out_of_range{ "chunkSize == 0" };
+		}
+		// Split the edges among the chunks by their expected weight, as randomCounts does among vertices
+		const size_t verticesCount{ _parameters.verticesCount };
+		const size_t chunksCount{ (verticesCount + _chunkSize - 1) / _chunkSize };
+		const double slope{ (1 - _parameters.backwardsEdgeDensityFactor) / (verticesCount - 1) };
+		std::vector<double> shares(chunksCount);
+		double weightSum{};
+		for (size_t c{}; c < chunksCount; c++)
+		{
+			const double first{ static_cast<double>(c * _chunkSize) };
+			const double count{ static_cast<double>(std::min(_chunkSize, verticesCount - c * _chunkSize)) };
+			weightSum += shares[c] = count - slope * (2 * first + count - 1) * count / 2;
+		}
+		m_chunkEdgesCounts.resize(chunksCount);
+		std::vector<std::pair<double, size_t>> remainders(chunksCount);
+		size_t countSum{};
+		for (size_t c{}; c < chunksCount; c++)
+		{
+			const double share{ weightSum ? shares[c] / weightSum * _parameters.edgesCount : 0 };
+			countSum += m_chunkEdgesCounts[c] = static_cast<size_t>(share);
+			remainders[c] = { share - std::floor(share), c };
+		}
+		std::sort(remainders.begin(), remainders.end(), [](const auto& _a, const auto& _b) { return _a.first > _b.first || (_a.first == _b.first && _a.second < _b.second); });
+		for (size_t r{}; countSum < _parameters.edgesCount; r = (r + 1) % chunksCount)
+		{
+			m_chunkEdgesCounts[remainders[r].second]++;
+			countSum++;
+		}
+		// No vertex can have more than verticesCount - 1 out-edges
+		size_t excess{};
+		for (size_t c{}; c < chunksCount; c++)
+		{
+			const size_t max{ std::min(_chunkSize, verticesCount - c * _chunkSize) * (verticesCount - 1) };
+			if (m_chunkEdgesCounts[c] > max)
+			{
+				excess += m_chunkEdgesCounts[c] - max;
+				m_chunkEdgesCounts[c] = max;
+			}
+		}
+		for (size_t c{}; c < chunksCount && excess; c++)
+		{
+			const size_t max{ std::min(_chunkSize, verticesCount - c * _chunkSize) * (verticesCount - 1) };
+			const size_t added{ std::min(max - m_chunkEdgesCounts[c], excess) };
+			m_chunkEdgesCounts[c] += added;
+			excess -= added;
+		}
+	}
+
+	std::vector<RandomGenerator::Arc> RandomGenerator::generateChunk(size_t _chunk) const
+	{
+		const size_t verticesCount{ m_parameters.verticesCount };
+		const size_t first{ _chunk * m_chunkSize };
+		const size_t chunkSize{ std::min(m_chunkSize, verticesCount - first) };
+		std::seed_seq seed{ m_seed, static_cast<unsigned int>(_chunk), static_cast<unsigned int>(static_cast<std::uint64_t>(_chunk) >> 32) };
+		std::mt19937 generator{ seed };
+		const std::vector<size_t> counts{ randomCounts(verticesCount, first, chunkSize, m_chunkEdgesCounts[_chunk], m_parameters.backwardsEdgeDensityFactor, generator) };
+		std::bernoulli_distribution backwardDistribution{ m_parameters.backwardsEdgeDensityFactor };
+		std::unordered_set<size_t> picked{};
+		std::vector<Arc> arcs{};
+		arcs.reserve(m_chunkEdgesCounts[_chunk]);
+		for (size_t i{}; i < chunkSize; i++)
+		{
+			const size_t from{ first + i };
+			const size_t backwardRange{ from }, forwardRange{ verticesCount - from - 1 };
+			size_t backwardCount{}, forwardCount{};
+			for (size_t c{}; c < counts[i]; c++)
+			{
+				if (backwardCount < backwardRange && (forwardCount == forwardRange || backwardDistribution(generator)))
+				{
+					backwardCount++;
+				}
+				else
+				{
+					forwardCount++;
+				}
+			}
+			sampleDistinct(backwardRange, backwardCount, generator, picked, [&](size_t _to) {
+				arcs.push_back({ .from{ from }, .to{ _to }, .capacity{ randomCapacity(m_parameters, generator) } });
+			});
+			sampleDistinct(forwardRange, forwardCount, generator, picked, [&](size_t _to) {
+				arcs.push_back({ .from{ from }, .to{ from + 1 + _to }, .capacity{ randomCapacity(m_parameters, generator) } });
+			});
+		}
+		return arcs;
+	}
+
+	std::vector<RandomGenerator::Arc> RandomGenerator::generateExpansion() const
+	{
+		std::vector<Arc> arcs(m_parameters.expand);
+		for (size_t i{}; i < m_parameters.expand; i++)
+		{
+			arcs[i] = { .from{ m_parameters.verticesCount - 1 + i }, .to{ m_parameters.verticesCount + i }, .capacity{ m_parameters.maxCapacity } };
+		}
+		return arcs;
+	}
+
+	size_t RandomGenerator::verticesCount() const
+	{
+		return m_parameters.verticesCount + m_parameters.expand;
+	}
+
+	size_t RandomGenerator::edgesCount() const
+	{
+		return m_parameters.edgesCount + m_parameters.expand;
+	}
+
+	size_t RandomGenerator::source() const
+	{
+		return 0;
+	}
+
+	size_t RandomGenerator::sink() const
+	{
+		return verticesCount() - 1;
+	}
+
+	size_t RandomGenerator::chunksCount() const
+	{
+		return m_chunkEdgesCounts.size();
+	}
+
+	void RandomGenerator::generate(const Consumer& _consumer, unsigned int _threadsCount) const
+	{
+		if (!_threadsCount)
+		{
+			_threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+		// While a batch of chunks is consumed, the next one is being generated
+		const auto launch{ [&](size_t _first) {
+			std::vector<std::future<std::vector<Arc>>> batch{};
+			for (size_t c{ _first }; c < std::min<size_t>(_first + _threadsCount, chunksCount()); c++)
+			{
+				batch.push_back(std::async(std::launch::async, &RandomGenerator::generateChunk, this, c));
+			}
+			return batch;
+		} };
+		std::vector<std::future<std::vector<Arc>>> batch{ launch(0) };
+		for (size_t first{}; first < chunksCount(); first += _threadsCount)
+		{
+			std::vector<std::future<std::vector<Arc>>> nextBatch{ launch(first + _threadsCount) };
+			for (std::future<std::vector<Arc>>& chunk : batch)
+			{
+				const std::vector<Arc> arcs{ chunk.get() };
+				_consumer(arcs);
+			}
+			batch = std::move(nextBatch);
+		}
+		const std::vector<Arc> expansion{ generateExpansion() };
+		_consumer(expansion);
+	}
+
+	Graphs::FlowEdgeList RandomGenerator::toEdgeList(unsigned int _threadsCount) const
+	{
+		Graphs::FlowEdgeList edgeList{ verticesCount() };
+		edgeList.reserve(edgesCount());
+		generate([&](std::span<const Arc> _arcs) {
+			for (const Arc& arc : _arcs)
+			{
+				edgeList.addEdge(arc.from, arc.to, arc.capacity);
+			}
+		}, _threadsCount);
+		return edgeList;
+	}
+
+	void RandomGenerator::writeDimacs(std::ostream& _stream, unsigned int _threadsCount) const
+	{
+		_stream << "c random max-flow instance, seed " << m_seed << '\n';
+		_stream << "p max " << verticesCount() << ' ' << edgesCount() << '\n';
+		_stream << "n " << source() + 1 << " s\n";
+		_stream << "n " << sink() + 1 << " t\n";
+		std::string buffer{};
+		generate([&](std::span<const Arc> _arcs) {
+			buffer.clear();
+			char line[3 * 21 + 4];
+			for (const Arc& arc : _arcs)
+			{
+				char* pEnd{ line };
+				*pEnd++ = 'a';
+				for (const size_t value : { arc.from + 1, arc.to + 1, static_cast<size_t>(arc.capacity) })
+				{
+					*pEnd++ = ' ';
+					pEnd = std::to_chars(pEnd, line + sizeof(line), value).ptr;
+				}
+				*pEnd++ = '\n';
+				buffer.append(line, pEnd);
+			}
+			_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		}, _threadsCount);
+	}
+
+	void RandomGenerator::writeDimacsFile(const std::string& _file, unsigned int _threadsCount) const
+	{
+		std::ofstream file{ _file };
+		if (!file)
+		{
+			throw std::invalid_argument{ "cannot open '" + _file + "'" };
+		}
+		writeDimacs(file, _threadsCount);
+		file.close();
+	}
+
+	void RandomGenerator::writeBinary(std::ostream& _stream, unsigned int _threadsCount) const
+	{
+		for (const std::uint64_t value : { verticesCount(), edgesCount(), source(), sink() })
+		{
+			writeRaw(_stream, value);
+		}
+		std::vector<std::uint64_t> buffer{};
+		generate([&](std::span<const Arc> _arcs) {
+			buffer.clear();
+			for (const Arc& arc : _arcs)
+			{
+				buffer.insert(buffer.end(), { arc.from, arc.to, arc.capacity });
+			}
+			_stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(std::uint64_t)));
+		}, _threadsCount);
+	}
+
+	void RandomGenerator::writeBinaryFile(const std::string& _file, unsigned int _threadsCount) const
+	{
+		std::ofstream file{ _file, std::ios::binary };
+		if (!file)
+		{
+			throw std::invalid_argument{ "cannot open '" + _file + "'" };
+		}
+		writeBinary(file, _threadsCount);
+		file.close();
+	}
+
 }
\ No newline at end of file
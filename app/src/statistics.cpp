@@ -0,0 +1,59 @@
+#include <max-flow-app/statistics.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <stdexcept>
+
+namespace MaxFlow::App
+{
+
+	namespace
+	{
+
+		constexpr double madNormalScale{ 1.4826 };
+		constexpr double z95{ 1.959964 };
+
+		// _samples must be sorted
+		double sortedMedian (const std::vector<double>& _samples)
+		{
+			const size_t n{ _samples.size () };
+			return n % 2 ? _samples[n / 2] : (_samples[n / 2 - 1] + _samples[n / 2]) / 2;
+		}
+
+	}
+
+	bool SampleStatistics::isOutlier (double _sample) const
+	{
+		if (mad == 0)
+		{
+			return _sample != median;
+		}
+		return std::abs (_sample - median) > outlierThreshold * mad;
+	}
+
+	SampleStatistics computeStatistics (std::vector<double> _samples)
+	{
+		if (_samples.empty ())
+		{
+			throw std::invalid_argument{ "no samples" };
+		}
+		const size_t n{ _samples.size () };
+		std::sort (_samples.begin (), _samples.end ());
+		SampleStatistics statistics{};
+		statistics.count = n;
+		statistics.median = sortedMedian (_samples);
+		statistics.mean = std::accumulate (_samples.begin (), _samples.end (), 0.0) / n;
+		std::vector<double> deviations (n);
+		std::transform (_samples.begin (), _samples.end (), deviations.begin (), [&] (double _sample) { return std::abs (_sample - statistics.median); });
+		std::sort (deviations.begin (), deviations.end ());
+		statistics.mad = madNormalScale * sortedMedian (deviations);
+		// Ranks n/2 -+ z sqrt(n)/2 of the normal approximation to the binomial distribution of the sample median rank
+		const double halfWidth{ z95 * std::sqrt (static_cast<double>(n)) / 2 };
+		const double low{ std::floor (n / 2.0 - halfWidth) }, high{ std::ceil (n / 2.0 + halfWidth) };
+		statistics.medianLow = _samples[static_cast<size_t>(std::max (low, 0.0))];
+		statistics.medianHigh = _samples[static_cast<size_t>(std::min (high, static_cast<double>(n - 1)))];
+		return statistics;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,479 @@
+#include <max-flow-app/suites.hpp>
+
+#include <stdexcept>
+
+namespace MaxFlow::App
+{
+
+	const std::vector<Suite>& suites()
+	{
+		static const std::vector<Suite> suites{
+			{
+				.name{ "zeroEdgeRemoval" },
+				.solvers{
+					{ESolver::FordFulkerson},
+					{ESolver::FifoPreflowPush},
+					{ESolver::FordFulkerson, ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::FifoPreflowPush, ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{10000}, .verticesCount{10000}, .edgesCount{20000}},
+				},
+			},
+			{
+				.name{ "capacityVariance" },
+				.solvers{
+					{ESolver::FordFulkerson, ESolverFlags::FordFulkersonDepthFirst},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+				},
+			},
+			{
+				.name{ "fordFulkersonDepthFirst" },
+				.solvers{
+					{ESolver::FordFulkerson},
+					{ESolver::FordFulkerson, ESolverFlags::FordFulkersonDepthFirst},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{10000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{20000}, .verticesCount{2000}, .edgesCount{40000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{40000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+				},
+			},
+			{
+				.name{ "fordFulkersonBidirectional" },
+				.solvers{
+					{ESolver::FordFulkerson},
+					{ESolver::FordFulkerson, ESolverFlags::FordFulkersonBidirectional},
+					{ESolver::CapacityScalingFordFulkerson, ESolverFlags::CapacityScalingRemoveDeltaEdges},
+					{ESolver::CapacityScalingFordFulkerson, ESolverFlags::CapacityScalingRemoveDeltaEdges + ESolverFlags::FordFulkersonBidirectional},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+				},
+			},
+			{
+				.name{ "shortestPathMinCutDetection" },
+				.solvers{
+					{ESolver::ShortestPath},
+					{ESolver::ShortestPath, ESolverFlags::ShortestPathDetectMinCut},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "capacityScalingSubSolver" },
+				.solvers{
+					{ESolver::CapacityScalingFordFulkerson},
+					{ESolver::CapacityScalingShortestPath, ESolverFlags::ShortestPathDetectMinCut},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "deltaEdgesRemoval" },
+				.solvers{
+					{ESolver::CapacityScalingFordFulkerson},
+					{ESolver::CapacityScalingFordFulkerson, ESolverFlags::CapacityScalingRemoveDeltaEdges},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "labeling" },
+				.solvers{
+					{ESolver::FordFulkerson},
+					{ESolver::ShortestPath, ESolverFlags::ShortestPathDetectMinCut},
+					{ESolver::CapacityScalingShortestPath, ESolverFlags::ShortestPathDetectMinCut},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{2000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{4000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{400000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{8000}},
+				},
+			},
+			{
+				.name{ "preflowPush" },
+				.solvers{
+					{ESolver::FifoPreflowPush},
+					{ESolver::HighestLabelPreflowPush},
+					{ESolver::ExcessScalingPreflowPush},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{2000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{4000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{400000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{8000}},
+				},
+			},
+			{
+				.name{ "capacityVarianceRZE" },
+				.solvers{
+					{ESolver::FordFulkerson, ESolverFlags::FordFulkersonDepthFirst + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{1000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{2000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{4000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-1}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{-0.5}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{0.5}},
+					{.maxCapacity{8000}, .verticesCount{5000}, .edgesCount{10000}, .capacityDeviance{1}},
+				},
+			},
+			{
+				.name{ "fordFulkersonDepthFirstRZE" },
+				.solvers{
+					{ESolver::FordFulkerson,  ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::FordFulkerson, ESolverFlags::FordFulkersonDepthFirst + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{10000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{20000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{40000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+				},
+			},
+			{
+				.name{ "shortestPathMinCutDetectionRZE" },
+				.solvers{
+					{ESolver::ShortestPath, ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::ShortestPath, ESolverFlags::ShortestPathDetectMinCut + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "capacityScalingSubSolverRZE" },
+				.solvers{
+					{ESolver::CapacityScalingFordFulkerson,ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::CapacityScalingShortestPath, ESolverFlags::ShortestPathDetectMinCut + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "deltaEdgesRemovalRZE" },
+				.solvers{
+					{ESolver::CapacityScalingFordFulkerson,ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::CapacityScalingFordFulkerson, ESolverFlags::CapacityScalingRemoveDeltaEdges + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{5000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{10000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{20000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{40000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "labelingRZE" },
+				.solvers{
+					{ESolver::FordFulkerson,ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::ShortestPath, ESolverFlags::ShortestPathDetectMinCut + ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::CapacityScalingShortestPath, ESolverFlags::ShortestPathDetectMinCut + ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{2000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{4000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{400000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{8000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{16000}},
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{800000}},
+					{.maxCapacity{8000000}, .verticesCount{8000}, .edgesCount{16000}},
+				},
+			},
+			{
+				.name{ "preflowPushRZE" },
+				.solvers{
+					{ESolver::FifoPreflowPush,ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::HighestLabelPreflowPush,ESolverFlags::RemoveZeroEdgeLabels},
+					{ESolver::ExcessScalingPreflowPush,ESolverFlags::RemoveZeroEdgeLabels},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{2000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{4000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{400000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{8000}},
+				},
+			},
+			{
+				.name{ "preflowPushExpandRZE" },
+				.solvers{
+					{ESolver::FifoPreflowPush},
+					{ESolver::FordFulkerson},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{1000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{4000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{8000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{16000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{32000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}, .expand{64000}},
+				},
+			},
+			{
+				.name{ "unitCapacity" },
+				.solvers{
+					{ESolver::FordFulkerson},
+					{ESolver::UnitCapacity},
+					{ESolver::FifoPreflowPush, ESolverFlags::DetectUnitCapacities},
+				},
+				.problems{
+					{.maxCapacity{1}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{1}, .verticesCount{4000}, .edgesCount{40000}},
+					{.maxCapacity{1}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "excessScaling" },
+				.solvers{
+					{ESolver::NaifExcessScalingPreflowPush},
+					{ESolver::ExcessScalingPreflowPush},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{40000}},
+
+					{.maxCapacity{8000}, .verticesCount{8000}, .edgesCount{80000}},
+					{.maxCapacity{8000000}, .verticesCount{8000}, .edgesCount{80000}},
+				},
+			},
+			{
+				.name{ "dischargeFifo" },
+				.solvers{
+					{ESolver::FifoPreflowPush},
+					{ESolver::DischargeFifoPreflowPush},
+					{ESolver::DischargeFifoPreflowPush, ESolverFlags::DischargeFifoWave},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{2000}},
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{4000}},
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{8000}},
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+				},
+			},
+			{
+				.name{ "capacityScalingPreflowPush" },
+				.solvers{
+					{ESolver::FifoPreflowPush},
+					{ESolver::HighestLabelPreflowPush},
+					{ESolver::CapacityScalingFifoPreflowPush},
+					{ESolver::CapacityScalingHighestLabelPreflowPush},
+				},
+				.problems{
+					{.maxCapacity{1000}, .verticesCount{1000}, .edgesCount{10000}},
+					{.maxCapacity{1000000}, .verticesCount{1000}, .edgesCount{10000}},
+
+					{.maxCapacity{2000}, .verticesCount{2000}, .edgesCount{20000}},
+					{.maxCapacity{2000000}, .verticesCount{2000}, .edgesCount{20000}},
+
+					{.maxCapacity{4000}, .verticesCount{4000}, .edgesCount{40000}},
+					{.maxCapacity{4000000}, .verticesCount{4000}, .edgesCount{40000}},
+				},
+			},
+		};
+		return suites;
+	}
+
+	const Suite& suite(const std::string& _name)
+	{
+		for (const Suite& suite : suites())
+		{
+			if (suite.name == _name)
+			{
+				return suite;
+			}
+		}
+		throw std::invalid_argument{ "unknown suite '" + _name + "'" };
+	}
+
+}
\ No newline at end of file
@@ -8,7 +8,11 @@
 #include <sstream>
 #include <fstream>
 #include <array>
+#include <variant>
+#include <type_traits>
 #include <iostream>
+#include <iomanip>
+#include <initializer_list>
 
 using MaxFlow::App::Performance;
 
@@ -20,28 +24,102 @@ namespace MaxFlow::App
 		return _seedRepetition * m_problems.size() * m_solvers.size() * m_repetitions + _repetition * m_problems.size() * m_solvers.size() + _solver * m_problems.size() + _problem;
 	}
 
-	Test::Test(const std::vector<RandomParameters>& _problems, const std::vector<SolverParameters>& _solvers, unsigned int _repetitions, unsigned int _seed, unsigned int _seedRepetitions, bool _skipZeroFlows)
-		: m_problems{ _problems }, m_solvers{ _solvers }, m_repetitions{ _repetitions }, m_seed{ _seed }, m_seedRepetitions{ _seedRepetitions }, m_skipZeroFlows{ _skipZeroFlows }, m_data(_problems.size()* _solvers.size()* _repetitions* _seedRepetitions)
+	size_t Test::warmUpIndex(size_t _problem, size_t _solver, unsigned int _warmUpRepetition, unsigned int _seedRepetition) const
 	{
-		if (_problems.empty() || _solvers.empty() || !_repetitions || !_seedRepetitions)
+		return _seedRepetition * m_problems.size() * m_solvers.size() * m_warmUpRepetitions + _warmUpRepetition * m_problems.size() * m_solvers.size() + _solver * m_problems.size() + _problem;
+	}
+
+	Test::Test(const std::vector<ProblemParameters>& _problems, const std::vector<SolverParameters>& _solvers, const TestParameters& _parameters)
+		: m_problems{ _problems }, m_solvers{ _solvers }, m_repetitions{ _parameters.repetitions }, m_seed{ _parameters.seed }, m_seedRepetitions{ _parameters.seedRepetitions }, m_skipZeroFlows{ _parameters.skipZeroFlows },
+		m_warmUpRepetitions{ _parameters.warmUpRepetitions }, m_threadsCount{ _parameters.threadsCount }, m_hardwareCounters{ _parameters.hardwareCounters }, m_checkSolverContext{ _parameters.checkSolverContext }, m_data(_problems.size()* _solvers.size()* _parameters.repetitions* _parameters.seedRepetitions),
+		m_warmUpData(_problems.size()* _solvers.size()* _parameters.warmUpRepetitions* _parameters.seedRepetitions)
+	{
+		if (_problems.empty() || _solvers.empty() || !_parameters.repetitions || !_parameters.seedRepetitions)
 		{
 			throw std::out_of_range{ "zero tests" };
 		}
 		run();
 	}
 
-	double Test::run(const RandomProblem& _problem, const SolverParameters& _parameters, Graphs::flow_t _maxFlowReference)
+	Test::Test(const std::vector<ProblemParameters>& _problems, const std::vector<SolverParameters>& _solvers, unsigned int _repetitions, unsigned int _seed, unsigned int _seedRepetitions, bool _skipZeroFlows)
+		: Test{ _problems, _solvers, TestParameters{ .repetitions{ _repetitions }, .seed{ _seed }, .seedRepetitions{ _seedRepetitions }, .skipZeroFlows{ _skipZeroFlows } } }
+	{}
+
+	Test::Test(const std::vector<RandomParameters>& _problems, const std::vector<SolverParameters>& _solvers, unsigned int _repetitions, unsigned int _seed, unsigned int _seedRepetitions, bool _skipZeroFlows)
+		: Test{ std::vector<ProblemParameters>{ _problems.begin(), _problems.end() }, _solvers, _repetitions, _seed, _seedRepetitions, _skipZeroFlows }
+	{}
+
+	Graphs::flow_t ensureMaxFlow(const FlowGraph& _graph, const Problem& _problem, unsigned int _threadsCount)
 	{
+		const FlowVertex& source{ _graph[_problem.source().index()] }, & sink{ _graph[_problem.sink().index()] };
+		const FlowCheck check{ checkFlow(_graph, source, sink, _threadsCount) };
+		if (!check.isFlow())
+		{
+			throw std::logic_error{ "not a flow: " + check.toString() };
+		}
+		if (!isCutSaturated(_graph, source, sink, check.flow))
+		{
+			throw std::logic_error{ "not a max flow" };
+		}
+		return check.flow;
+	}
+
+	void ensureSolverContextReuse(const Problem& _problem, const SolverParameters& _parameters, Graphs::flow_t _flow, unsigned int _threadsCount)
+	{
+		// The residual graph is restored between the two solves, so the second one starts from scratch with the solver and buffers of the first
 		FlowGraph workingGraph{ _problem.graph() };
 		workingGraph.setMatrix(true);
 		Graphs::ResidualGraph residualGraph{ Graphs::createResidualGraph(workingGraph) };
 		residualGraph.setMatrix(true);
 		const GenericCapacityMatrix capacityMatrix{ workingGraph };
-		Performance::start();
-		solve(residualGraph, residualGraph[_problem.source().index()], residualGraph[_problem.sink().index()], capacityMatrix, _parameters.solver, _parameters.flags);
-		const double time{ Performance::end() };
+		Graphs::ResidualVertex& source{ residualGraph[_problem.source().index()] }, & sink{ residualGraph[_problem.sink().index()] };
+		SolverContext context{ _parameters.solver, _parameters.flags };
+		for (unsigned int s{ 0 }; s < 2; s++)
+		{
+			if (s)
+			{
+				for (Graphs::ResidualVertex& vertex : residualGraph)
+				{
+					for (Graphs::ResidualEdge& edge : vertex)
+					{
+						*edge = capacityMatrix.capacity(vertex.index(), edge.to().index());
+					}
+				}
+				// Zero edge removal may have dropped saturated arcs
+				for (const FlowVertex& vertex : workingGraph)
+				{
+					for (const FlowEdge& edge : vertex)
+					{
+						if (edge->capacity() && !residualGraph[vertex.index()].outEdgeIfExists(edge.to().index()))
+						{
+							*residualGraph[vertex.index()].addOutEdge(edge.to().index()) = capacityMatrix.capacity(vertex.index(), edge.to().index());
+						}
+					}
+				}
+			}
+			context.solve(residualGraph, source, sink, capacityMatrix);
+			if (context.flowValue() != _flow)
+			{
+				throw std::logic_error{ "solver context solve " + std::to_string(s + 1) + " found " + std::to_string(context.flowValue()) + " instead of " + std::to_string(_flow) };
+			}
+		}
 		Graphs::updateFlowsFromResidualGraph(residualGraph, workingGraph);
-		ensureMaxFlow(workingGraph, workingGraph[_problem.source().index()], workingGraph[_problem.sink().index()], _maxFlowReference);
+		ensureMaxFlow(workingGraph, _problem, _threadsCount);
+	}
+
+	Measurement Test::run(const Problem& _problem, const SolverParameters& _parameters) const
+	{
+		FlowGraph workingGraph{ _problem.graph() };
+		// Every solver is timed from the flow graph to the flows written back, so the residual graph is always included and the reduction is timed on top of it when enabled
+		Performance performance{ m_hardwareCounters };
+		performance.start();
+		solve(workingGraph, workingGraph[_problem.source().index()], workingGraph[_problem.sink().index()], _parameters.solver, _parameters.flags);
+		const Measurement time{ performance.end() };
+		const Graphs::flow_t flow{ ensureMaxFlow(workingGraph, _problem, m_threadsCount) };
+		if (m_checkSolverContext)
+		{
+			ensureSolverContextReuse(_problem, _parameters, flow, m_threadsCount);
+		}
 		return time;
 	}
 
@@ -63,6 +141,20 @@ namespace MaxFlow::App
 		}
 	}
 
+	void logTime(const Measurement& _measurement)
+	{
+		log("Time", std::to_string(_measurement.wallTime) + "s");
+		log("Cpu", std::to_string(_measurement.cpuTime) + "s");
+		if (_measurement.counters.cycles)
+		{
+			log("Cycles", std::to_string(*_measurement.counters.cycles));
+		}
+		if (_measurement.counters.instructions)
+		{
+			log("Instr", std::to_string(*_measurement.counters.instructions));
+		}
+	}
+
 	void Test::logProgress(size_t _current) const
 	{
 		std::cout << '(' << progress(_current, m_data.size()) << ')';
@@ -92,6 +184,7 @@ namespace MaxFlow::App
 	{
 		size_t count{};
 		bool anyZeroFlows{};
+		bool anyMissingCounters{};
 		for (size_t p{ 0 }; p < m_problems.size(); p++)
 		{
 			unsigned int zeroFlowSkips{ 0 };
@@ -104,11 +197,12 @@ namespace MaxFlow::App
 				bool zeroFlowSkippedThisRound{ false };
 				while (!done)
 				{
-					const RandomProblem problem{ m_problems[p], m_seed + sr + zeroFlowSkips };
-					const Graphs::flow_t maxFlowReference{ getMaxFlow(problem.graph(), problem.source(), problem.sink()) };
-					if (!maxFlowReference)
+					const Problem problem{ m_problems[p], m_seed + sr + zeroFlowSkips };
+					const bool zeroFlow{ !isSinkReachable(problem.graph(), problem.source(), problem.sink()) };
+					if (zeroFlow)
 					{
-						if (m_skipZeroFlows)
+						// Instances that do not depend on the seed cannot be skipped
+						if (m_skipZeroFlows && isSeeded(m_problems[p]))
 						{
 							if (!zeroFlowSkippedThisRound)
 							{
@@ -119,7 +213,7 @@ namespace MaxFlow::App
 							zeroFlowSkips++;
 							continue;
 						}
-						anyZeroFlows |= !maxFlowReference;
+						anyZeroFlows = true;
 					}
 					done = true;
 					if (zeroFlowSkippedThisRound)
@@ -127,11 +221,22 @@ namespace MaxFlow::App
 						std::cout << "]";
 					}
 					log("ActualSeed", std::to_string(m_seed + sr + zeroFlowSkips));
-					log("ActualFlow", std::to_string(maxFlowReference));
 					std::cout << std::endl;
 					for (size_t s{ 0 }; s < m_solvers.size(); s++)
 					{
 						const SolverParameters& solverParameters{ m_solvers[s] };
+						for (unsigned int w{ 0 }; w < m_warmUpRepetitions; w++)
+						{
+							logProgress(count);
+							logProblem(p);
+							logSeedRepetition(sr);
+							logSolver(s);
+							log("WarmUp", progress(w, m_warmUpRepetitions));
+							const Measurement time{ run(problem, solverParameters) };
+							m_warmUpData[warmUpIndex(p, s, w, sr)] = time;
+							logTime(time);
+							std::cout << std::endl;
+						}
 						for (unsigned int r{ 0 }; r < m_repetitions; r++)
 						{
 							logProgress(count++);
@@ -139,9 +244,21 @@ namespace MaxFlow::App
 							logSeedRepetition(sr);
 							logSolver(s);
 							logRepetition(r);
-							const double time{ run(problem, solverParameters, maxFlowReference) };
+							const Measurement time{ run(problem, solverParameters) };
 							m_data[index(p, s, r, sr)] = time;
-							log("Time", std::to_string(time) + "s");
+							anyMissingCounters |= m_hardwareCounters && !time.counters.any();
+							logTime(time);
+							std::cout << std::endl;
+						}
+						if (m_repetitions > 1)
+						{
+							const SampleStatistics statistics{ this->statistics(p, s, sr) };
+							logProblem(p);
+							logSeedRepetition(sr);
+							logSolver(s);
+							log("Median", std::to_string(statistics.median) + "s");
+							log("MAD", std::to_string(statistics.mad) + "s");
+							log("CI95", std::to_string(statistics.medianLow) + "s," + std::to_string(statistics.medianHigh) + "s");
 							std::cout << std::endl;
 						}
 					}
@@ -152,9 +269,13 @@ namespace MaxFlow::App
 		{
 			std::cout << "Warning: zero flows detected" << std::endl;
 		}
+		if (anyMissingCounters)
+		{
+			std::cout << "Warning: hardware counters unavailable (check /proc/sys/kernel/perf_event_paranoid)" << std::endl;
+		}
 	}
 
-	const std::vector<RandomParameters> Test::problems() const
+	const std::vector<ProblemParameters> Test::problems() const
 	{
 		return m_problems;
 	}
@@ -174,12 +295,62 @@ namespace MaxFlow::App
 		return m_seed;
 	}
 
+	unsigned int Test::seedRepetitions() const
+	{
+		return m_seedRepetitions;
+	}
+
+	bool Test::skipZeroFlows() const
+	{
+		return m_skipZeroFlows;
+	}
+
+	unsigned int Test::warmUpRepetitions() const
+	{
+		return m_warmUpRepetitions;
+	}
+
+	unsigned int Test::threadsCount() const
+	{
+		return m_threadsCount;
+	}
+
+	bool Test::hardwareCounters() const
+	{
+		return m_hardwareCounters;
+	}
+
+	bool Test::checkSolverContext() const
+	{
+		return m_checkSolverContext;
+	}
+
 	double Test::test(size_t _problem, size_t _solver, unsigned int _repetition, unsigned int _seedRepetition) const
+	{
+		return m_data[index(_problem, _solver, _repetition, _seedRepetition)].wallTime;
+	}
+
+	const Measurement& Test::measurement(size_t _problem, size_t _solver, unsigned int _repetition, unsigned int _seedRepetition) const
 	{
 		return m_data[index(_problem, _solver, _repetition, _seedRepetition)];
 	}
 
-	constexpr std::string solverName(ESolver _solver)
+	const Measurement& Test::warmUpMeasurement(size_t _problem, size_t _solver, unsigned int _warmUpRepetition, unsigned int _seedRepetition) const
+	{
+		return m_warmUpData[warmUpIndex(_problem, _solver, _warmUpRepetition, _seedRepetition)];
+	}
+
+	SampleStatistics Test::statistics(size_t _problem, size_t _solver, unsigned int _seedRepetition) const
+	{
+		std::vector<double> samples(m_repetitions);
+		for (unsigned int r{ 0 }; r < m_repetitions; r++)
+		{
+			samples[r] = test(_problem, _solver, r, _seedRepetition);
+		}
+		return computeStatistics(samples);
+	}
+
+	std::string solverName(ESolver _solver)
 	{
 		switch (_solver)
 		{
@@ -189,16 +360,26 @@ namespace MaxFlow::App
 			return "CapacityScalingFordFulkerson";
 		case MaxFlow::ESolver::CapacityScalingShortestPath:
 			return "CapacityScalingShortestPath";
+		case MaxFlow::ESolver::CapacityScalingFifoPreflowPush:
+			return "CapacityScalingFifoPreflowPush";
+		case MaxFlow::ESolver::CapacityScalingHighestLabelPreflowPush:
+			return "CapacityScalingHighestLabelPreflowPush";
 		case MaxFlow::ESolver::ShortestPath:
 			return "ShortestPath";
 		case MaxFlow::ESolver::NaifPreflowPush:
 			return "NaifPreflowPush";
 		case MaxFlow::ESolver::FifoPreflowPush:
 			return "FifoPreflowPush";
+		case MaxFlow::ESolver::DischargeFifoPreflowPush:
+			return "DischargeFifoPreflowPush";
 		case MaxFlow::ESolver::HighestLabelPreflowPush:
 			return "HighestLabelPreflowPush";
 		case MaxFlow::ESolver::ExcessScalingPreflowPush:
 			return "ExcessScalingPreflowPush";
+		case MaxFlow::ESolver::NaifExcessScalingPreflowPush:
+			return "NaifExcessScalingPreflowPush";
+		case MaxFlow::ESolver::UnitCapacity:
+			return "UnitCapacity";
 		default:
 			throw std::invalid_argument{ "unknown solver" };
 		}
@@ -229,6 +410,7 @@ namespace MaxFlow::App
 				ss << '+';
 			}
 			ss << "DMC";
+			nonempty = true;
 		}
 		if (_flags & ESolverFlags::FordFulkersonDepthFirst)
 		{
@@ -237,14 +419,114 @@ namespace MaxFlow::App
 				ss << '+';
 			}
 			ss << "DF";
+			nonempty = true;
+		}
+		if (_flags & ESolverFlags::DischargeFifoWave)
+		{
+			if (nonempty)
+			{
+				ss << '+';
+			}
+			ss << "WAVE";
+			nonempty = true;
+		}
+		if (_flags & ESolverFlags::FordFulkersonBidirectional)
+		{
+			if (nonempty)
+			{
+				ss << '+';
+			}
+			ss << "BD";
+			nonempty = true;
+		}
+		if (_flags & ESolverFlags::ReduceGraph)
+		{
+			if (nonempty)
+			{
+				ss << '+';
+			}
+			ss << "RED";
+			nonempty = true;
+		}
+		if (_flags & ESolverFlags::DetectUnitCapacities)
+		{
+			if (nonempty)
+			{
+				ss << '+';
+			}
+			ss << "UNIT";
 		}
 		return ss.str();
 	}
 
-	std::string Test::toCsv() const
+	// family, familyParameters, then the RandomParameters columns, left empty where the family has no such parameter
+	std::string problemCsvColumns(const ProblemParameters& _problem)
 	{
 		std::stringstream ss{};
 		ss << std::fixed;
+		ss << familyName(_problem) << ',';
+		ss << familyParameters(_problem) << ',';
+		std::visit([&](const auto& _family) {
+			using TFamily = std::decay_t<decltype(_family)>;
+			if constexpr (std::is_same_v<TFamily, RandomParameters>)
+			{
+				ss << _family.maxCapacity << ',';
+				ss << _family.verticesCount << ',';
+				ss << _family.edgesCount << ',';
+				ss << _family.backwardsEdgeDensityFactor << ',';
+				ss << _family.capacityDeviance << ',';
+				ss << _family.expand << ',';
+			}
+			else if constexpr (std::is_same_v<TFamily, DimacsParameters>)
+			{
+				ss << ",,,,,,";
+			}
+			else
+			{
+				if constexpr (std::is_same_v<TFamily, AkParameters>)
+				{
+					ss << _family.length << ',';
+				}
+				else
+				{
+					ss << _family.maxCapacity << ',';
+				}
+				ss << _family.verticesCount() << ',';
+				ss << _family.edgesCount() << ',';
+				ss << ",,,";
+			}
+		}, _problem);
+		return ss.str();
+	}
+
+	// cycles, instructions, l1dMisses, llcMisses, branchMisses, left empty where unavailable
+	std::string countersCsvColumns(const HardwareCounters& _counters)
+	{
+		std::stringstream ss{};
+		bool first{ true };
+		for (const std::optional<std::uint64_t>& counter : { _counters.cycles, _counters.instructions, _counters.l1dMisses, _counters.llcMisses, _counters.branchMisses })
+		{
+			if (!first)
+			{
+				ss << ',';
+			}
+			if (counter)
+			{
+				ss << *counter;
+			}
+			first = false;
+		}
+		return ss.str();
+	}
+
+	// Timed runs repeat the statistics of their group; warm-up runs leave them empty
+	std::string Test::toCsv() const
+	{
+		std::stringstream ss{};
+		// Nanosecond resolution
+		ss << std::fixed << std::setprecision(9);
+		ss << "family,";
+		ss << "familyParameters,";
 		ss << "maxCapacity,";
 		ss << "verticesCount,";
 		ss << "edgesCount,";
@@ -255,29 +537,59 @@ namespace MaxFlow::App
 		ss << "solverFlags,";
 		ss << "repetition,";
 		ss << "seedRepetition,";
-		ss << "time";
+		ss << "time,";
+		ss << "cpuTime,";
+		ss << "warmUp,";
+		ss << "medianTime,";
+		ss << "madTime,";
+		ss << "medianTimeLow,";
+		ss << "medianTimeHigh,";
+		ss << "outlier,";
+		ss << "cycles,";
+		ss << "instructions,";
+		ss << "l1dMisses,";
+		ss << "llcMisses,";
+		ss << "branchMisses";
 		ss << std::endl;
 		for (size_t p{ 0 }; p < m_problems.size(); p++)
 		{
-			const RandomParameters& problem{ m_problems[p] };
+			const std::string problemColumns{ problemCsvColumns(m_problems[p]) };
 			for (unsigned int sr{ 0 }; sr < m_seedRepetitions; sr++)
 			{
 				for (size_t s{ 0 }; s < m_solvers.size(); s++)
 				{
 					const SolverParameters& solver{ m_solvers[s] };
+					const std::string solverColumns{ solverName(solver.solver) + ',' + solverFlagsName(solver.flags) + ',' };
+					for (unsigned int w{ 0 }; w < m_warmUpRepetitions; w++)
+					{
+						const Measurement& measurement{ warmUpMeasurement(p, s, w, sr) };
+						ss << problemColumns;
+						ss << solverColumns;
+						ss << w + 1 << ',';
+						ss << sr + 1 << ',';
+						ss << measurement.wallTime << ',';
+						ss << measurement.cpuTime << ',';
+						ss << "1,,,,,,";
+						ss << countersCsvColumns(measurement.counters);
+						ss << std::endl;
+					}
+					const SampleStatistics statistics{ this->statistics(p, s, sr) };
 					for (unsigned int r{ 0 }; r < m_repetitions; r++)
 					{
-						ss << problem.maxCapacity << ',';
-						ss << problem.verticesCount << ',';
-						ss << problem.edgesCount << ',';
-						ss << problem.backwardsEdgeDensityFactor << ',';
-						ss << problem.capacityDeviance << ',';
-						ss << problem.expand << ',';
-						ss << solverName(solver.solver) << ',';
-						ss << solverFlagsName(solver.flags) << ',';
+						const Measurement& measurement{ this->measurement(p, s, r, sr) };
+						ss << problemColumns;
+						ss << solverColumns;
 						ss << r + 1 << ',';
 						ss << sr + 1 << ',';
-						ss << test(p, s, r, sr);
+						ss << measurement.wallTime << ',';
+						ss << measurement.cpuTime << ',';
+						ss << "0,";
+						ss << statistics.median << ',';
+						ss << statistics.mad << ',';
+						ss << statistics.medianLow << ',';
+						ss << statistics.medianHigh << ',';
+						ss << statistics.isOutlier(measurement.wallTime) << ',';
+						ss << countersCsvColumns(measurement.counters);
 						ss << std::endl;
 					}
 				}
@@ -2,6 +2,11 @@
 
 #include <vector>
 #include <stdexcept>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <type_traits>
 #include <max-flow/solve.hpp>
 
 using MaxFlow::Graphs::flow_t;
@@ -9,53 +14,255 @@ using MaxFlow::Graphs::flow_t;
 namespace MaxFlow::App
 {
 
-	bool isFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
+	namespace
 	{
-		FlowGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
-		std::vector<flow_t> outFlows(_graph.verticesCount(), 0);
-		std::vector<flow_t> inFlows(_graph.verticesCount(), 0);
-		for (const FlowVertex& vertex : _graph)
+
+		constexpr size_t minVerticesPerThread{ 1 << 14 };
+
+		std::vector<size_t> partitionVertices(const FlowGraph& _graph, unsigned int _threadsCount)
 		{
-			for (const FlowEdge& edge : vertex)
+			const size_t verticesCount{ _graph.verticesCount() };
+			if (!_threadsCount)
 			{
-				outFlows[edge.from().index()] += edge->flow();
-				inFlows[edge.to().index()] += edge->flow();
+				_threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
 			}
+			_threadsCount = static_cast<unsigned int>(std::clamp<size_t>(verticesCount / minVerticesPerThread, 1, _threadsCount));
+			const size_t work{ verticesCount + _graph.edgesCount() };
+			std::vector<size_t> bounds{ 0 };
+			size_t done{ 0 };
+			for (size_t v{ 0 }; v < verticesCount && bounds.size() < _threadsCount; v++)
+			{
+				done += 1 + _graph[v].outEdgesCount();
+				if (done * _threadsCount >= work * bounds.size())
+				{
+					bounds.push_back(v + 1);
+				}
+			}
+			bounds.push_back(verticesCount);
+			return bounds;
 		}
-		for (size_t i{ 0 }; i < _graph.verticesCount(); i++)
+
+		template<typename TFunction>
+		void forEachPartition(const std::vector<size_t>& _bounds, const TFunction& _function)
 		{
-			if (outFlows[i] != inFlows[i] && i != _source.index() && i != _sink.index())
+			const size_t partitionsCount{ _bounds.size() - 1 };
+			if (partitionsCount == 1)
 			{
-				return false;
+				_function(0, _bounds[0], _bounds[1]);
+				return;
 			}
+			std::vector<std::jthread> threads{};
+			threads.reserve(partitionsCount - 1);
+			for (size_t p{ 1 }; p < partitionsCount; p++)
+			{
+				threads.emplace_back(_function, p, _bounds[p], _bounds[p + 1]);
+			}
+			_function(0, _bounds[0], _bounds[1]);
 		}
-		if ((outFlows[_source.index()] < inFlows[_source.index()]) ||
-			(outFlows[_sink.index()] > inFlows[_sink.index()]) ||
-			(outFlows[_source.index()] - inFlows[_source.index()] != inFlows[_sink.index()] - outFlows[_sink.index()]))
+
+		std::vector<bool> getResidualReachability(const FlowGraph& _graph, const FlowVertex& _source)
 		{
-			return false;
+			const size_t verticesCount{ _graph.verticesCount() };
+			std::vector<size_t> firstInEdges(verticesCount + 1, 0);
+			for (const FlowVertex& vertex : _graph)
+			{
+				for (const FlowEdge& edge : vertex)
+				{
+					firstInEdges[edge.to().index() + 1]++;
+				}
+			}
+			for (size_t v{ 0 }; v < verticesCount; v++)
+			{
+				firstInEdges[v + 1] += firstInEdges[v];
+			}
+			std::vector<const FlowEdge*> inEdges(firstInEdges[verticesCount]);
+			{
+				std::vector<size_t> cursors{ firstInEdges.begin(), firstInEdges.end() - 1 };
+				for (const FlowVertex& vertex : _graph)
+				{
+					for (const FlowEdge& edge : vertex)
+					{
+						inEdges[cursors[edge.to().index()]++] = &edge;
+					}
+				}
+			}
+			std::vector<bool> reached(verticesCount, false);
+			std::vector<size_t> queue{};
+			queue.reserve(verticesCount);
+			queue.push_back(_source.index());
+			reached[_source.index()] = true;
+			for (size_t q{ 0 }; q < queue.size(); q++)
+			{
+				const size_t v{ queue[q] };
+				for (const FlowEdge& edge : _graph[v])
+				{
+					const size_t to{ edge.to().index() };
+					if (!reached[to] && edge->residualCapacity())
+					{
+						reached[to] = true;
+						queue.push_back(to);
+					}
+				}
+				for (size_t i{ firstInEdges[v] }; i < firstInEdges[v + 1]; i++)
+				{
+					const FlowEdge& edge{ *inEdges[i] };
+					const size_t from{ edge.from().index() };
+					if (!reached[from] && edge->flow())
+					{
+						reached[from] = true;
+						queue.push_back(from);
+					}
+				}
+			}
+			return reached;
+		}
+
+	}
+
+	bool FlowCheck::isFlow() const
+	{
+		return violation == EViolation::None;
+	}
+
+	std::string FlowCheck::toString() const
+	{
+		switch (violation)
+		{
+		case EViolation::None:
+			return "flow " + std::to_string(flow);
+		case EViolation::Capacity:
+			return "flow > capacity on an edge leaving vertex " + std::to_string(vertex);
+		case EViolation::Conservation:
+			return "flow not conserved at vertex " + std::to_string(vertex);
+		case EViolation::Terminals:
+			return "negative flow out of the source";
+		default:
+			throw std::invalid_argument{ "unknown violation" };
 		}
-		return true;
+	}
+
+	FlowCheck checkFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, unsigned int _threadsCount)
+	{
+		FlowGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
+		const std::vector<size_t> bounds{ partitionVertices(_graph, _threadsCount) };
+		const bool concurrent{ bounds.size() > 2 };
+		// in-flow minus out-flow, modulo 2^64
+		std::vector<flow_t> netFlows(_graph.verticesCount(), 0);
+		std::vector<FlowCheck> partitionViolations(bounds.size() - 1);
+		forEachPartition(bounds, [&](size_t _partition, size_t _begin, size_t _end) {
+			const auto add{ [&](size_t _vertex, flow_t _amount) {
+				if (concurrent)
+				{
+					std::atomic_ref<flow_t>{ netFlows[_vertex] }.fetch_add(_amount, std::memory_order_relaxed);
+				}
+				else
+				{
+					netFlows[_vertex] += _amount;
+				}
+			} };
+			FlowCheck& check{ partitionViolations[_partition] };
+			for (size_t v{ _begin }; v < _end; v++)
+			{
+				flow_t outFlow{ 0 };
+				for (const FlowEdge& edge : _graph[v])
+				{
+					const flow_t flow{ edge->flow() };
+					if (flow > edge->capacity() && check.isFlow())
+					{
+						check = { .violation{ FlowCheck::EViolation::Capacity }, .vertex{ v } };
+					}
+					outFlow += flow;
+					add(edge.to().index(), flow);
+				}
+				add(v, -outFlow);
+			}
+		});
+		forEachPartition(bounds, [&](size_t _partition, size_t _begin, size_t _end) {
+			FlowCheck& check{ partitionViolations[_partition] };
+			const size_t end{ check.isFlow() ? _end : check.vertex };
+			for (size_t v{ _begin }; v < end; v++)
+			{
+				if (netFlows[v] && v != _source.index() && v != _sink.index())
+				{
+					check = { .violation{ FlowCheck::EViolation::Conservation }, .vertex{ v } };
+					break;
+				}
+			}
+		});
+		for (const FlowCheck& check : partitionViolations)
+		{
+			if (!check.isFlow())
+			{
+				return check;
+			}
+		}
+		if (_source == _sink)
+		{
+			return {};
+		}
+		// the other vertices conserve flow, so the sink receives exactly what the source sends
+		const flow_t flow{ -netFlows[_source.index()] };
+		if (static_cast<std::make_signed_t<flow_t>>(flow) < 0)
+		{
+			return { .violation{ FlowCheck::EViolation::Terminals }, .vertex{ _source.index() } };
+		}
+		return { .flow{ flow } };
+	}
+
+	bool isFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
+	{
+		return checkFlow(_graph, _source, _sink).isFlow();
 	}
 
 	bool isMaxFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, flow_t _maxFlow)
 	{
-		if (!isFlow(_graph, _source, _sink))
+		const FlowCheck check{ checkFlow(_graph, _source, _sink) };
+		return check.isFlow() && check.flow == _maxFlow;
+	}
+
+	bool isMaxFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
+	{
+		const FlowCheck check{ checkFlow(_graph, _source, _sink) };
+		return check.isFlow() && isCutSaturated(_graph, _source, _sink, check.flow);
+	}
+
+	bool isCutSaturated(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink, flow_t _flow)
+	{
+		FlowGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
+		const std::vector<bool> sourceSide{ getResidualReachability(_graph, _source) };
+		if (sourceSide[_sink.index()])
 		{
 			return false;
 		}
-		return getFlow(_graph, _source) == _maxFlow;
+		flow_t cutCapacity{ 0 };
+		for (const FlowVertex& vertex : _graph)
+		{
+			if (sourceSide[vertex.index()])
+			{
+				for (const FlowEdge& edge : vertex)
+				{
+					if (!sourceSide[edge.to().index()])
+					{
+						cutCapacity += edge->capacity();
+					}
+				}
+			}
+		}
+		return cutCapacity == _flow;
 	}
 
-	bool isMaxFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink) {
-		return isMaxFlow(_graph, _source, _sink, getMaxFlow(_graph, _source, _sink));
+	bool isSinkReachable(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
+	{
+		FlowGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
+		return getResidualReachability(_graph, _source)[_sink.index()];
 	}
 
 	void ensureFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
 	{
-		if (!isFlow(_graph, _source, _sink))
+		const FlowCheck check{ checkFlow(_graph, _source, _sink) };
+		if (!check.isFlow())
 		{
-			throw std::logic_error{ "not a flow" };
+			throw std::logic_error{ "not a flow: " + check.toString() };
 		}
 	}
 
@@ -69,7 +276,10 @@ namespace MaxFlow::App
 
 	void ensureMaxFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
 	{
-		ensureMaxFlow(_graph, _source, _sink, getMaxFlow(_graph, _source, _sink));
+		if (!isMaxFlow(_graph, _source, _sink))
+		{
+			throw std::logic_error{ "not a max flow" };
+		}
 	}
 
 	Graphs::flow_t getMaxFlow(const FlowGraph& _graph, const FlowVertex& _source, const FlowVertex& _sink)
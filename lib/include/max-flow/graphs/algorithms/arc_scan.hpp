@@ -0,0 +1,31 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_ARC_SCAN
+#define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_ARC_SCAN
+
+#include <max-flow/graphs/compact_residual.hpp>
+
+namespace MaxFlow::Graphs::Algorithms
+{
+
+	// Vectorized scans over the out arcs of a vertex
+	// The kernel is selected at runtime according to the CPU features
+
+	enum class EArcScanKernel
+	{
+		Scalar, AVX2, AVX512
+	};
+
+	EArcScanKernel arcScanKernel ();
+	void setArcScanKernel (EArcScanKernel _kernel);
+
+	// First arc with positive residual capacity whose head has distance _distance, or noArc
+	size_t findArcToDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex, size_t _distance);
+
+	// Same, skipping the arcs of the vertex before _firstArc
+	size_t findArcToDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex, size_t _distance, size_t _firstArc);
+
+	// Minimum distance of the heads of the arcs with positive residual capacity
+	size_t minHeadDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex);
+
+}
+
+#endif
\ No newline at end of file
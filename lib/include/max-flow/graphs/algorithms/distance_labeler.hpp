@@ -1,10 +1,11 @@
 #ifndef INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_DISTANCE_LABELER
 #define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_DISTANCE_LABELER
 
-#include <max-flow/graphs/residual.hpp>
+#include <max-flow/graphs/compact_residual.hpp>
 #include <max-flow/utils/reference_equatable.hpp>
 #include <max-flow/graphs/algorithms/edge_selector.hpp>
 #include <vector>
+#include <limits>
 #include <compare>
 
 namespace MaxFlow::Graphs::Algorithms
@@ -41,29 +42,35 @@ namespace MaxFlow::Graphs::Algorithms
 
 		};
 
+		static constexpr size_t noDistance{ std::numeric_limits<size_t>::max () };
+
 	private:
 
-		ResidualGraph& m_graph;
-		ResidualVertex& m_source, & m_sink;
-		std::vector<Label> m_labels;
+		const CompactResidualGraph& m_graph;
+		size_t m_source, m_sink;
+		std::vector<size_t> m_distances;
+		std::vector<size_t> m_queue;
 
 	public:
 
-		DistanceLabeler(ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink);
+		DistanceLabeler(const CompactResidualGraph& _graph, size_t _source, size_t _sink);
 
 		void reset();
 
 		void calculate(EdgeSelector& _edgeSelector = EdgeSelector::all);
 
-		void setLabel(ResidualVertex& _vertex, Label _label);
+		void setLabel(size_t _vertex, Label _label);
+
+		void setDistance(size_t _vertex, size_t _distance);
 
-		void setDistance(ResidualVertex& _vertex, size_t _distance);
+		void resetDistance(size_t _vertex);
 
-		void resetDistance(ResidualVertex& _vertex);
+		Label operator[](size_t _vertex) const;
 
-		Label operator[](const ResidualVertex& _vertex) const;
+		bool isAdmissible(size_t _from, size_t _arc) const;
 
-		bool isAdmissible(const ResidualEdge& _edge) const;
+		// Indexed by vertex, noDistance if not labeled
+		const size_t* distances() const;
 
 	};
 
@@ -1,7 +1,7 @@
 #ifndef INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_EDGE_SELECTOR
 #define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_EDGE_SELECTOR
 
-#include <max-flow/graphs/residual.hpp>
+#include <max-flow/graphs/compact_residual.hpp>
 
 namespace MaxFlow::Graphs::Algorithms
 {
@@ -13,7 +13,7 @@ namespace MaxFlow::Graphs::Algorithms
 
 		static EdgeSelector all;
 
-		virtual bool operator() (const ResidualEdge& _edge);
+		virtual bool operator() (const CompactResidualGraph& _graph, size_t _arc);
 
 	};
 
@@ -1,13 +1,12 @@
 #ifndef INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_PATHFINDER
 #define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_PATHFINDER
 
-#include <max-flow/graphs/residual.hpp>
+#include <max-flow/graphs/compact_residual.hpp>
+#include <max-flow/graphs/delta_residual_view.hpp>
 #include <max-flow/graphs/algorithms/edge_selector.hpp>
 #include <max-flow/utils/reference_equatable.hpp>
 #include <vector>
 #include <iterator>
-#include <type_traits>
-#include <concepts>
 
 namespace MaxFlow::Graphs::Algorithms
 {
@@ -19,13 +18,25 @@ namespace MaxFlow::Graphs::Algorithms
 
 	private:
 
-		ResidualGraph& m_graph;
-		ResidualVertex& m_source, & m_sink;
-		std::vector<ResidualVertex*> m_predecessors;
+		static constexpr size_t rootArc{ CompactResidualGraph::noArc - 1 };
+
+		const CompactResidualGraph& m_graph;
+		size_t m_source, m_sink;
+		std::vector<size_t> m_predecessorArcs;
+		std::vector<size_t> m_frontier;
+		std::vector<size_t> m_successorArcs;
+		std::vector<size_t> m_backwardFrontier;
+		std::vector<size_t> m_labeledVertices;
+
+		void assignPredecessor (size_t _vertex, size_t _arc);
+
+		template<typename TForwardArcs, typename TBackwardArcs>
+		void calculateBidirectional (TForwardArcs _forwardArcs, TBackwardArcs _backwardArcs);
 
 	public:
 
-		template<bool constant>
+		// Iterates over the arcs of the path, from the sink to the source
+
 		class Iterator final
 		{
 
@@ -33,29 +44,24 @@ namespace MaxFlow::Graphs::Algorithms
 
 			using iterator_category = std::forward_iterator_tag;
 			using difference_type = std::ptrdiff_t;
-			using value_type = std::conditional_t<constant, const ResidualEdge, ResidualEdge>;
-			using reference = value_type&;
-			using pointer = value_type*;
-			using pathfinder = std::conditional_t<constant, const Pathfinder, Pathfinder>;
-			using vertex = std::conditional_t<constant, const ResidualVertex, ResidualVertex>;
+			using value_type = size_t;
+			using reference = size_t;
+			using pointer = void;
 
 		private:
 
 			friend class Pathfinder;
 
-			vertex* m_p;
-			pathfinder& m_pathfinder;
+			const Pathfinder* m_pPathfinder;
+			size_t m_vertex;
 
-			Iterator (pathfinder& _pathfinder, vertex& _current);
+			Iterator (const Pathfinder& _pathfinder, size_t _vertex);
 
 		public:
 
-			operator Pathfinder::Iterator<true> () const;
-
 			// Getters
 
-			reference operator*() const;
-			pointer operator->() const;
+			size_t operator*() const;
 
 			// Iteration
 
@@ -64,39 +70,45 @@ namespace MaxFlow::Graphs::Algorithms
 
 			// Comparison
 
-			template<bool constantOther>
-			bool operator==(const Iterator<constantOther>& _other) const;
+			bool operator==(const Iterator& _other) const;
 
 		};
 
-		using IteratorC = Iterator<true>;
-		using IteratorM = Iterator<false>;
+		Pathfinder (const CompactResidualGraph& _graph, size_t _source, size_t _sink);
 
-		Pathfinder (ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink);
+		const CompactResidualGraph& graph () const;
 
 		void reset ();
 
 		void calculateDepthFirst (EdgeSelector& _edgeSelector = EdgeSelector::all);
 		void calculateBreadthFirst(EdgeSelector& _edgeSelector = EdgeSelector::all);
 
-		void setPredecessor (ResidualVertex& _vertex, ResidualVertex& _predecessor);
-		void setPredecessor (ResidualEdge& _edge);
-		void resetPredecessor (ResidualVertex& _vertex);
+		// Only follow the eligible arcs of the view, which must be built on the same graph
+
+		void calculateDepthFirst (const DeltaResidualView& _view);
+		void calculateBreadthFirst (const DeltaResidualView& _view);
+
+		// Breadth first from both the source and the sink, always expanding the smaller level, until the two searches meet
+		// Only the vertices labeled from the source and the vertices of the path are labeled afterwards
 
-		const ResidualVertex& operator[](const ResidualVertex& _vertex) const;
-		ResidualVertex& operator[](ResidualVertex& _vertex);
+		void calculateBidirectional (EdgeSelector& _edgeSelector = EdgeSelector::all);
+		void calculateBidirectional (const DeltaResidualView& _view);
 
-		bool isLabeled (const ResidualVertex& _vertex) const;
+		void setPredecessor (size_t _arc);
+		void resetPredecessor (size_t _vertex);
+
+		size_t predecessorArc (size_t _vertex) const;
+		size_t operator[](size_t _vertex) const;
+
+		bool isLabeled (size_t _vertex) const;
 		bool isSinkLabeled () const;
 		bool isSourceLabeled () const;
 
-		IteratorC begin () const;
-		IteratorC cbegin () const;
-		IteratorM begin ();
+		Iterator begin () const;
+		Iterator cbegin () const;
 
-		IteratorC end () const;
-		IteratorC cend () const;
-		IteratorM end ();
+		Iterator end () const;
+		Iterator cend () const;
 
 	};
 
@@ -104,48 +116,39 @@ namespace MaxFlow::Graphs::Algorithms
 
 #pragma region Implementation
 
-	template<bool c>
-	inline Pathfinder::Iterator<c>::Iterator (pathfinder& _pathfinder, vertex& _current) : m_pathfinder{ _pathfinder }, m_p{ &_current }
-	{}
-	
-	template<bool c>
-	inline Pathfinder::Iterator<c>::operator Pathfinder::IteratorC () const
+	inline void Pathfinder::assignPredecessor (size_t _vertex, size_t _arc)
 	{
-		return Pathfinder::IteratorC{ m_pathfinder, *m_p };
+		if (m_predecessorArcs[_vertex] == CompactResidualGraph::noArc)
+		{
+			m_labeledVertices.push_back (_vertex);
+		}
+		m_predecessorArcs[_vertex] = _arc;
 	}
 
-	template<bool c>
-	inline Pathfinder::Iterator<c>::reference Pathfinder::Iterator<c>::operator*() const
-	{
-		return m_pathfinder[*m_p][*m_p];
-	}
+	inline Pathfinder::Iterator::Iterator (const Pathfinder& _pathfinder, size_t _vertex) : m_pPathfinder{ &_pathfinder }, m_vertex{ _vertex }
+	{}
 
-	template<bool c>
-	inline Pathfinder::Iterator<c>::pointer Pathfinder::Iterator<c>::operator->() const
+	inline size_t Pathfinder::Iterator::operator*() const
 	{
-		return &m_pathfinder[*m_p][*m_p];
+		return m_pPathfinder->m_predecessorArcs[m_vertex];
 	}
 
-	template<bool c>
-	inline Pathfinder::Iterator<c>& Pathfinder::Iterator<c>::operator++()
+	inline Pathfinder::Iterator& Pathfinder::Iterator::operator++()
 	{
-		m_p = &m_pathfinder[*m_p];
+		m_vertex = m_pPathfinder->m_graph.tail (**this);
 		return *this;
 	}
 
-	template<bool c>
-	inline Pathfinder::Iterator<c> Pathfinder::Iterator<c>::operator++(int)
+	inline Pathfinder::Iterator Pathfinder::Iterator::operator++(int)
 	{
 		Iterator last{ *this };
 		++* this;
 		return last;
 	}
 
-	template<bool c>
-	template<bool co>
-	inline bool Pathfinder::Iterator<c>::operator==(const Pathfinder::Iterator<co>& _other) const
+	inline bool Pathfinder::Iterator::operator==(const Pathfinder::Iterator& _other) const
 	{
-		return _other.m_pathfinder == m_pathfinder && _other.m_p == m_p;
+		return _other.m_pPathfinder == m_pPathfinder && _other.m_vertex == m_vertex;
 	}
 
 #pragma endregion
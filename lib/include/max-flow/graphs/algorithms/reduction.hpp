@@ -0,0 +1,72 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_REDUCTION
+#define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_REDUCTION
+
+#include <max-flow/graphs/edge_list.hpp>
+#include <span>
+#include <vector>
+
+namespace MaxFlow::Graphs::Algorithms
+{
+
+	// Pre-solve reduction of a flow network with the same maximum flow value
+	// Drops zero-capacity arcs, self loops, arcs entering the source or leaving the sink and the vertices that are not both reachable from the source and reaching the sink
+	// When combining arcs, parallel arcs are merged and every series chain (a non-terminal vertex with a single in arc and a single out arc) is contracted into a single arc
+	// Every flow on the reduced network expands back to a flow of the same value on the original one
+
+	class Reduction final
+	{
+
+	private:
+
+		enum class ENode
+		{
+			Edge, Series, Parallel
+		};
+
+		// Reduced arcs are trees of original edges, combined in series or in parallel
+		struct Node
+		{
+
+			ENode kind;
+			flow_t capacity;
+			// Original edge index for ENode::Edge
+			size_t first, second;
+
+		};
+
+		struct Arc
+		{
+
+			size_t from, to, node;
+
+		};
+
+		size_t m_edgesCount;
+		std::vector<Node> m_nodes{};
+		FlowEdgeList m_reduced{};
+		std::vector<size_t> m_reducedNodes{};
+		size_t m_source{}, m_sink{};
+
+		size_t addNode (ENode _kind, size_t _first, size_t _second);
+		void mergeParallelArcs (std::vector<Arc>& _arcs);
+		void contractSeriesArcs (std::vector<Arc>& _arcs, size_t _verticesCount, size_t _source, size_t _sink);
+
+	public:
+
+		// Merging and contracting arcs changes the capacities, so both can be disabled for solvers that rely on unit capacities
+		Reduction (size_t _verticesCount, size_t _source, size_t _sink, std::span<const FlowEdgeList::Edge> _edges, bool _combineArcs = true);
+
+		const FlowEdgeList& reduced () const;
+		FlowEdgeList& reduced ();
+
+		size_t source () const;
+		size_t sink () const;
+
+		// Flow of every original edge, by index, expanded from the current flows of the reduced edges
+		std::vector<flow_t> originalFlows () const;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define INCLUDED_MAX_FLOW_GRAPH_ALGORITHMS_RESIDUAL
 
 #include <max-flow/graphs/residual.hpp>
+#include <max-flow/graphs/compact_residual.hpp>
 #include <max-flow/graphs/algorithms/pathfinder.hpp>
 
 namespace MaxFlow::Graphs::Algorithms
@@ -23,11 +24,11 @@ namespace MaxFlow::Graphs::Algorithms
 
 	void addZeroEdges (Graphs::ResidualGraph& _graph);
 
-	flow_t minCapacity (Pathfinder::IteratorC _start, Pathfinder::IteratorC _end);
+	flow_t minCapacity (const CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end);
 
-	void augment (Pathfinder::IteratorM _start, Pathfinder::IteratorM _end, flow_t _amount, bool _removeZeroEdge = defaultRemoveZeroEdgeOnAugment);
+	void augment (CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end, flow_t _amount);
 
-	void augmentMax (Pathfinder::IteratorM _start, Pathfinder::IteratorM _end, bool _removeZeroEdge = defaultRemoveZeroEdgeOnAugment);
+	void augmentMax (CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end);
 
 }
 
@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <cstddef>
 #include <stdexcept>
+#include <limits>
 #include <max-flow/utils/reference_type.hpp>
 #include <max-flow/graphs/base/vertex.hpp>
 #include <max-flow/utils/iteration/contiguous_indirect.hpp>
@@ -37,6 +38,8 @@ namespace MaxFlow::Graphs::Base
 
 		// Utils
 
+		static constexpr size_t noIndex{ std::numeric_limits<size_t>::max () };
+
 		void updateIndices (size_t _first);
 		void prepareForVertexInsertion (size_t _index, size_t _count);
 
@@ -54,6 +57,7 @@ namespace MaxFlow::Graphs::Base
 		// Vertex interface
 
 		void edgeAdded ();
+		void edgesAdded (size_t _count);
 		void edgeRemoved ();
 
 	protected:
@@ -120,6 +124,9 @@ namespace MaxFlow::Graphs::Base
 
 		void destroyVertex (Vertex& _vertex);
 		void destroyVertex (size_t _vertex);
+		// Destroys every vertex _destroyed[index] is set for, with its in and out edges, renumbering the others in a single pass
+		void destroyVertices (const std::vector<bool>& _destroyed);
+		template<typename TPredicate> void destroyVertices (const TPredicate& _predicate);
 		void destroyAllVertices ();
 
 		~Graph ();
@@ -149,6 +156,16 @@ namespace MaxFlow::Graphs::Base
 		}
 	}
 
+	template<typename TPredicate> inline void Graph::destroyVertices (const TPredicate& _predicate)
+	{
+		std::vector<bool> destroyed (verticesCount ());
+		for (Vertex& vertex : *this)
+		{
+			destroyed[vertex.index ()] = _predicate (vertex);
+		}
+		destroyVertices (destroyed);
+	}
+
 }
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define INCLUDED_MAX_FLOW_GRAPH_BASE_VERTEX
 
 #include <vector>
+#include <span>
 #include <cstddef>
 #include <max-flow/utils/reference_type.hpp>
 #include <max-flow/graphs/base/graph.hpp>
@@ -45,6 +46,8 @@ namespace MaxFlow::Graphs::Base
 
 		void verticesAdded (size_t _index, size_t _count);
 		void verticesDestroyed (size_t _index, size_t _count);
+		void verticesCompacted (const std::vector<size_t>& _newIndices, size_t _count);
+		void destroyOutEdgesTo (const std::vector<bool>& _destroyed);
 		void vertexSwapped (size_t _a, size_t _b);
 
 		void reserve (size_t _capacity);
@@ -67,6 +70,8 @@ namespace MaxFlow::Graphs::Base
 		// Edge insertion
 
 		void addNewValidatedOutEdge (Edge& _edge);
+		// Appends the edges in order, counting them once
+		void addNewValidatedOutEdges (std::span<Edge* const> _edges);
 
 		void ensureValidNewOutEdge (const Vertex& _to) const;
 		void ensureValidNewOutEdgeBefore (const Vertex& _to, const Edge& _next) const;
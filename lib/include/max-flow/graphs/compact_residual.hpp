@@ -0,0 +1,135 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPHS_COMPACT_RESIDUAL
+#define INCLUDED_MAX_FLOW_GRAPHS_COMPACT_RESIDUAL
+
+#include <max-flow/graphs/residual.hpp>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstddef>
+
+namespace MaxFlow::Graphs
+{
+
+	class CompactResidualGraph final
+	{
+
+	public:
+
+		static constexpr size_t noArc{ std::numeric_limits<size_t>::max () };
+
+	private:
+
+		// Arcs are grouped by tail vertex and sorted by head vertex inside each group
+		// Every arc has a reverse arc, possibly with zero residual capacity
+
+		std::vector<size_t> m_firstArcs{};
+		std::vector<size_t> m_heads{};
+		std::vector<size_t> m_reverses{};
+		std::vector<flow_t> m_residuals{};
+		// Scratch buffers of assign, kept so that reloading a graph of the same size does not allocate
+		std::vector<std::pair<size_t, flow_t>> m_sortBuffer{};
+		std::vector<size_t> m_nextArcs{};
+
+	public:
+
+		// Construction
+
+		CompactResidualGraph () = default;
+		explicit CompactResidualGraph (const ResidualGraph& _graph);
+
+		void assign (const ResidualGraph& _graph);
+		void writeBack (ResidualGraph& _graph, bool _removeZeroEdges) const;
+
+		// Getters
+
+		size_t verticesCount () const;
+		size_t arcsCount () const;
+
+		size_t firstArc (size_t _vertex) const;
+		size_t endArc (size_t _vertex) const;
+		size_t findArc (size_t _from, size_t _to) const;
+
+		size_t head (size_t _arc) const;
+		size_t tail (size_t _arc) const;
+		size_t reverse (size_t _arc) const;
+
+		flow_t residual (size_t _arc) const;
+		flow_t& residual (size_t _arc);
+
+		const size_t* heads () const;
+		const flow_t* residuals () const;
+
+		// Augmentation
+
+		void augment (size_t _arc, flow_t _amount);
+
+	};
+
+#pragma region Implementation
+
+	inline size_t CompactResidualGraph::verticesCount () const
+	{
+		return m_firstArcs.empty () ? 0 : m_firstArcs.size () - 1;
+	}
+
+	inline size_t CompactResidualGraph::arcsCount () const
+	{
+		return m_heads.size ();
+	}
+
+	inline size_t CompactResidualGraph::firstArc (size_t _vertex) const
+	{
+		return m_firstArcs[_vertex];
+	}
+
+	inline size_t CompactResidualGraph::endArc (size_t _vertex) const
+	{
+		return m_firstArcs[_vertex + 1];
+	}
+
+	inline size_t CompactResidualGraph::head (size_t _arc) const
+	{
+		return m_heads[_arc];
+	}
+
+	inline size_t CompactResidualGraph::tail (size_t _arc) const
+	{
+		return m_heads[m_reverses[_arc]];
+	}
+
+	inline size_t CompactResidualGraph::reverse (size_t _arc) const
+	{
+		return m_reverses[_arc];
+	}
+
+	inline flow_t CompactResidualGraph::residual (size_t _arc) const
+	{
+		return m_residuals[_arc];
+	}
+
+	inline flow_t& CompactResidualGraph::residual (size_t _arc)
+	{
+		return m_residuals[_arc];
+	}
+
+	inline const size_t* CompactResidualGraph::heads () const
+	{
+		return m_heads.data ();
+	}
+
+	inline const flow_t* CompactResidualGraph::residuals () const
+	{
+		return m_residuals.data ();
+	}
+
+	inline void CompactResidualGraph::augment (size_t _arc, flow_t _amount)
+	{
+		m_residuals[_arc] -= _amount;
+		m_residuals[m_reverses[_arc]] += _amount;
+	}
+
+#pragma endregion
+
+}
+
+#endif
\ No newline at end of file
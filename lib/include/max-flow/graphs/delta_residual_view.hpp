@@ -0,0 +1,116 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPHS_DELTA_RESIDUAL_VIEW
+#define INCLUDED_MAX_FLOW_GRAPHS_DELTA_RESIDUAL_VIEW
+
+#include <max-flow/graphs/compact_residual.hpp>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+namespace MaxFlow::Graphs
+{
+
+	class DeltaResidualView final
+	{
+
+	private:
+
+		// Arcs are indexed by the bucket floor(log2(residual)) they had when the view was reset, so that lowering delta only activates the buckets that became eligible
+		// Active arcs of each vertex are appended to the slots [firstArc, endArc) of the underlying graph and stay active once activated; arcs whose residual fell below delta are skipped by isEligible
+		// Augmenting an arc activates its reverse arc, so every arc with residual at least delta is active
+
+		CompactResidualGraph& m_graph;
+		flow_t m_delta{};
+		std::vector<size_t> m_bucketArcs{};
+		std::vector<size_t> m_firstBucketArcs{}, m_nextBucketArcs{};
+		size_t m_nextBucket{};
+		std::vector<size_t> m_activeArcs{};
+		std::vector<size_t> m_endActiveArcs{};
+		std::vector<bool> m_isActive{};
+		std::vector<size_t> m_activatedArcs{};
+
+		void activate (size_t _arc);
+
+	public:
+
+		explicit DeltaResidualView (CompactResidualGraph& _graph);
+
+		// Modifiers
+
+		void reset ();
+		void setDelta (flow_t _delta);
+		void augment (size_t _arc, flow_t _amount);
+
+		// Getters
+
+		const CompactResidualGraph& graph () const;
+		CompactResidualGraph& graph ();
+
+		flow_t delta () const;
+		flow_t maxDelta () const;
+
+		std::span<const size_t> arcs (size_t _vertex) const;
+		bool isActive (size_t _arc) const;
+		bool isEligible (size_t _arc) const;
+
+		// Arcs activated by the last call to setDelta
+		const std::vector<size_t>& activatedArcs () const;
+
+	};
+
+#pragma region Implementation
+
+	inline void DeltaResidualView::activate (size_t _arc)
+	{
+		if (!m_isActive[_arc])
+		{
+			m_isActive[_arc] = true;
+			m_activeArcs[m_endActiveArcs[m_graph.tail (_arc)]++] = _arc;
+		}
+	}
+
+	inline void DeltaResidualView::augment (size_t _arc, flow_t _amount)
+	{
+		m_graph.augment (_arc, _amount);
+		activate (m_graph.reverse (_arc));
+	}
+
+	inline const CompactResidualGraph& DeltaResidualView::graph () const
+	{
+		return m_graph;
+	}
+
+	inline CompactResidualGraph& DeltaResidualView::graph ()
+	{
+		return m_graph;
+	}
+
+	inline flow_t DeltaResidualView::delta () const
+	{
+		return m_delta;
+	}
+
+	inline std::span<const size_t> DeltaResidualView::arcs (size_t _vertex) const
+	{
+		return { m_activeArcs.data () + m_graph.firstArc (_vertex), m_activeArcs.data () + m_endActiveArcs[_vertex] };
+	}
+
+	inline bool DeltaResidualView::isActive (size_t _arc) const
+	{
+		return m_isActive[_arc];
+	}
+
+	inline const std::vector<size_t>& DeltaResidualView::activatedArcs () const
+	{
+		return m_activatedArcs;
+	}
+
+	inline bool DeltaResidualView::isEligible (size_t _arc) const
+	{
+		return m_graph.residual (_arc) >= m_delta;
+	}
+
+#pragma endregion
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPHS_EDGE_LIST
+#define INCLUDED_MAX_FLOW_GRAPHS_EDGE_LIST
+
+#include <max-flow/graphs/residual.hpp>
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+namespace MaxFlow::Graphs
+{
+
+	// Flow network given as a plain edge list, turned into a residual graph without an intermediate FlowGraph
+	// Parallel and antiparallel edges share residual arcs; every edge remembers the arc of its direction, so that flows are written back by index
+
+	class FlowEdgeList final
+	{
+
+	public:
+
+		struct Edge
+		{
+
+			size_t from{}, to{};
+			flow_t capacity{}, flow{};
+
+		};
+
+		static constexpr size_t noArc{ std::numeric_limits<size_t>::max () };
+
+	private:
+
+		size_t m_verticesCount{};
+		std::vector<Edge> m_edges{};
+		// Residual arcs, grouped by tail vertex and sorted by head vertex as in CompactResidualGraph
+		// Computed by createResidualGraph and discarded by any change to the list
+		std::vector<size_t> m_firstArcs{};
+		std::vector<size_t> m_heads{};
+		std::vector<flow_t> m_arcCapacities{};
+		std::vector<size_t> m_edgeArcs{};
+
+		void invalidateArcs ();
+		void ensureArcs () const;
+
+	public:
+
+		// Construction
+
+		explicit FlowEdgeList (size_t _verticesCount = 0);
+
+		// Getters
+
+		size_t verticesCount () const;
+		size_t edgesCount () const;
+
+		const std::vector<Edge>& edges () const;
+		const Edge& operator[] (size_t _edge) const;
+
+		// Modifiers
+
+		void addVertices (size_t _count);
+		void reserve (size_t _edgesCount);
+		void addEdge (size_t _from, size_t _to, flow_t _capacity, flow_t _flow = 0);
+
+		// Residual graph
+
+		// Has one edge per residual arc, both directions of every edge included
+		ResidualGraph createResidualGraph ();
+
+		size_t arcsCount () const;
+		size_t arc (size_t _edge) const;
+		// Total capacity of the edges from _from to _to
+		flow_t capacity (size_t _from, size_t _to) const;
+
+		// Sets the flow of every edge from the residual graph created by createResidualGraph, cancelling flow around antiparallel pairs
+		void updateFlows (const ResidualGraph& _residualGraph);
+
+	};
+
+}
+
+#endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define INCLUDED_MAX_FLOW_GRAPHS_FLOW
 
 #include <max-flow/graphs/generic/graph.hpp>
+#include <max-flow/graphs/generic/builder.hpp>
 
 namespace MaxFlow::Graphs
 {
@@ -56,6 +57,7 @@ namespace MaxFlow::Graphs
 	MF_GG_TT_FD using FlowGraph = Generic::Graph<TVertexData, EdgeFlow<TEdgeData>>;
 	MF_GG_TT_FD using FlowGraphVertex = FlowGraph<TVertexData, TEdgeData>::Vertex;
 	MF_GG_TT_FD using FlowGraphEdge = FlowGraph<TVertexData, TEdgeData>::Edge;
+	MF_GG_TT_FD using FlowGraphBuilder = Generic::GraphBuilder<TVertexData, EdgeFlow<TEdgeData>>;
 
 #pragma endregion
 
@@ -0,0 +1,243 @@
+#ifndef INCLUDED_MAX_FLOW_GRAPH_GENERIC_BUILDER
+#define INCLUDED_MAX_FLOW_GRAPH_GENERIC_BUILDER
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <max-flow/utils/non_void.hpp>
+#include <max-flow/graphs/generic/graph.hpp>
+#include <max-flow/graphs/generic/vertex.hpp>
+#include <max-flow/graphs/generic/edge.hpp>
+#include <max-flow/graphs/generic/macros.hpp>
+
+#define MF_GG_T GraphBuilder
+
+namespace MaxFlow::Graphs::Generic
+{
+
+#pragma region Declaration
+
+	// Collects an edge list and inserts it in a single pass
+	// Edges are grouped by tail with a counting sort (skipped when already grouped), validated once, and linked to their tail without per-edge bookkeeping
+
+	MF_GG_TT_F class GraphBuilder final
+	{
+
+	public:
+
+		MF_GG_UG;
+		MF_GG_UV;
+		MF_GG_UE;
+
+	private:
+
+		// Unused when there is no edge data
+		using EdgeDataStorage = std::conditional_t<std::is_void_v<TEdgeData>, bool, TEdgeData>;
+
+		static constexpr size_t none{ std::numeric_limits<size_t>::max () };
+
+		// Attributes
+
+		Graph& m_graph;
+		std::vector<size_t> m_tails{}, m_heads{};
+		std::vector<EdgeDataStorage> m_data{};
+		std::vector<size_t> m_order{}, m_firstEdges{}, m_cursors{}, m_stamps{};
+		std::vector<BEdge*> m_newEdges{};
+
+		// Utils
+
+		void sort ();
+		void validate ();
+
+	public:
+
+		// Construction
+
+		explicit GraphBuilder (Graph& _graph);
+
+		// Getters
+
+		const Graph& graph () const;
+		Graph& graph ();
+
+		size_t edgesCount () const;
+
+		// Edge insertion
+
+		void reserve (size_t _edgesCount);
+
+		void addEdge (size_t _from, size_t _to);
+		MF_U_NV_SA_D (EdgeData) void addEdge (size_t _from, size_t _to, const TNonVoidEdgeData& _data);
+		MF_U_NV_SA_D (EdgeData) void addEdge (size_t _from, size_t _to, TNonVoidEdgeData&& _data);
+
+		// Appends the pending edges after the existing out edges of their tail, in insertion order, and clears them
+		void build ();
+		void clear ();
+
+	};
+
+#pragma endregion
+
+#pragma region Implementation
+
+	MF_GG_CS (Graph& _graph) : m_graph{ _graph }
+	{}
+
+	MF_GG_MS (const MF_GG_A (Graph)&) graph () const
+	{
+		return m_graph;
+	}
+
+	MF_GG_MS (MF_GG_A (Graph)&) graph ()
+	{
+		return m_graph;
+	}
+
+	MF_GG_MS (size_t) edgesCount () const
+	{
+		return m_tails.size ();
+	}
+
+	MF_GG_MS (void) reserve (size_t _edgesCount)
+	{
+		m_tails.reserve (_edgesCount);
+		m_heads.reserve (_edgesCount);
+		if constexpr (!std::is_void_v<TED>)
+		{
+			m_data.reserve (_edgesCount);
+		}
+	}
+
+	MF_GG_MS (void) addEdge (size_t _from, size_t _to)
+	{
+		m_graph.ensureValidVertexIndex (_from);
+		m_graph.ensureValidVertexIndex (_to);
+		if constexpr (!std::is_void_v<TED>)
+		{
+			static_assert (std::is_default_constructible_v<TED>, "edge data is not default constructible, pass it to addEdge");
+			m_data.emplace_back ();
+		}
+		m_tails.push_back (_from);
+		m_heads.push_back (_to);
+	}
+
+	MF_GG_TT MF_U_NV_SA_I (ED) MF_GG_TMS (void) addEdge (size_t _from, size_t _to, const TNonVoidED& _data)
+	{
+		m_graph.ensureValidVertexIndex (_from);
+		m_graph.ensureValidVertexIndex (_to);
+		m_data.push_back (_data);
+		m_tails.push_back (_from);
+		m_heads.push_back (_to);
+	}
+
+	MF_GG_TT MF_U_NV_SA_I (ED) MF_GG_TMS (void) addEdge (size_t _from, size_t _to, TNonVoidED&& _data)
+	{
+		m_graph.ensureValidVertexIndex (_from);
+		m_graph.ensureValidVertexIndex (_to);
+		m_data.push_back (std::move (_data));
+		m_tails.push_back (_from);
+		m_heads.push_back (_to);
+	}
+
+	MF_GG_MS (void) sort ()
+	{
+		const size_t verticesCount{ m_graph.verticesCount () };
+		m_firstEdges.assign (verticesCount + 1, 0);
+		for (const size_t tail : m_tails)
+		{
+			m_firstEdges[tail + 1]++;
+		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			m_firstEdges[v + 1] += m_firstEdges[v];
+		}
+		m_order.resize (m_tails.size ());
+		if (std::is_sorted (m_tails.begin (), m_tails.end ()))
+		{
+			for (size_t e{ 0 }; e < m_order.size (); e++)
+			{
+				m_order[e] = e;
+			}
+		}
+		else
+		{
+			m_cursors.assign (m_firstEdges.begin (), m_firstEdges.end () - 1);
+			for (size_t e{ 0 }; e < m_tails.size (); e++)
+			{
+				m_order[m_cursors[m_tails[e]]++] = e;
+			}
+		}
+	}
+
+	MF_GG_MS (void) validate ()
+	{
+		// Without a matrix, addOutEdge does not reject parallel edges either
+		if (!m_graph.hasMatrix ())
+		{
+			return;
+		}
+		const size_t verticesCount{ m_graph.verticesCount () };
+		m_stamps.assign (verticesCount, none);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			const Vertex& from{ m_graph[v] };
+			for (size_t i{ m_firstEdges[v] }; i < m_firstEdges[v + 1]; i++)
+			{
+				const size_t head{ m_heads[m_order[i]] };
+				if (m_stamps[head] == v || from.hasOutEdge (head))
+				{
+					throw std::logic_error{ "edge already exists" };
+				}
+				m_stamps[head] = v;
+			}
+		}
+	}
+
+	MF_GG_MS (void) build ()
+	{
+		sort ();
+		validate ();
+		const size_t verticesCount{ m_graph.verticesCount () };
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (m_firstEdges[v] == m_firstEdges[v + 1])
+			{
+				continue;
+			}
+			Vertex& from{ m_graph[v] };
+			m_newEdges.clear ();
+			for (size_t i{ m_firstEdges[v] }; i < m_firstEdges[v + 1]; i++)
+			{
+				const size_t e{ m_order[i] };
+				if constexpr (std::is_void_v<TED>)
+				{
+					m_newEdges.push_back (new Edge{ from, m_graph[m_heads[e]], nullptr, nullptr });
+				}
+				else
+				{
+					m_newEdges.push_back (new Edge{ from, m_graph[m_heads[e]], nullptr, nullptr, std::move (m_data[e]) });
+				}
+			}
+			from.addNewValidatedOutEdges (m_newEdges);
+		}
+		clear ();
+	}
+
+	MF_GG_MS (void) clear ()
+	{
+		m_tails.clear ();
+		m_heads.clear ();
+		m_data.clear ();
+	}
+
+#pragma endregion
+
+}
+
+#undef MF_GG_T
+
+#endif
\ No newline at end of file
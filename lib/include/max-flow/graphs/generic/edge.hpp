@@ -31,6 +31,7 @@ namespace MaxFlow::Graphs::Generic
 		// Friend classes
 
 		friend class Vertex;
+		friend class GraphBuilder<TVertexData, TEdgeData>;
 
 		// Construction
 
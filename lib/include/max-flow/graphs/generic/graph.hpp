@@ -65,6 +65,11 @@ namespace MaxFlow::Graphs::Generic
 		MF_U_NV_SA_D(VertexData) Vertex& addVertexAt(size_t _next, const TNonVoidVertexData& _data);
 		MF_U_NV_SA_D(VertexData) Vertex& addVertexAt(size_t _next, TNonVoidVertexData&& _data);
 
+		// Destruction
+
+		using BGraph::destroyVertices;
+		template<typename TPredicate> void destroyVertices(const TPredicate& _predicate);
+
 		// Iteration
 
 		VertexIteratorFC begin() const;
@@ -168,6 +173,11 @@ namespace MaxFlow::Graphs::Generic
 	MF_GG_PC0(MF_GG_A(VertexIteratorFC), cend);
 	MF_GG_PC0(MF_GG_A(VertexIteratorRC), crend);
 
+	MF_GG_TT template<typename TPredicate> MF_GG_TMS(void) destroyVertices(const TPredicate& _predicate)
+	{
+		BGraph::destroyVertices([&](BVertex& _vertex) { return _predicate(static_cast<Vertex&>(_vertex)); });
+	}
+
 	MF_GG_TT MF_U_NV_SA_I(VD) MF_GG_TMS(MF_GG_A(Vertex)&) addVertex(const TNonVoidVD& _data)
 	{
 		return addVertexAt(verticesCount(), _data);
@@ -105,6 +105,7 @@ namespace MaxFlow::Graphs::Generic
 	MF_GG_TT_FD class Graph;
 	MF_GG_TT_FD class Edge;
 	MF_GG_TT_FD class Vertex;
+	MF_GG_TT_FD class GraphBuilder;
 
 }
 
@@ -35,6 +35,7 @@ namespace MaxFlow::Graphs::Generic
 		// Friend classes
 
 		friend class Graph;
+		friend class GraphBuilder<TVertexData, TEdgeData>;
 
 		// Vertex interface
 
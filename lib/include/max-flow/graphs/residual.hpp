@@ -2,8 +2,11 @@
 #define INCLUDED_MAX_FLOW_ALGORITHMS_RESIDUAL
 
 #include <max-flow/graphs/generic/graph.hpp>
+#include <max-flow/graphs/generic/builder.hpp>
 #include <max-flow/graphs/flow.hpp>
 #include <utility>
+#include <vector>
+#include <limits>
 #include <stdexcept>
 
 namespace MaxFlow::Graphs
@@ -14,6 +17,7 @@ namespace MaxFlow::Graphs
 	using ResidualGraph = Generic::Graph<void, flow_t>;
 	using ResidualVertex = ResidualGraph::Vertex;
 	using ResidualEdge = ResidualGraph::Edge;
+	using ResidualGraphBuilder = Generic::GraphBuilder<void, flow_t>;
 
 	MF_GG_TT_F static ResidualGraph createResidualGraph (const FlowGraph<TVertexData, TEdgeData>& _flowGraph);
 
@@ -25,21 +29,66 @@ namespace MaxFlow::Graphs
 
 	MF_GG_TT ResidualGraph createResidualGraph (const FlowGraph<TVD, TED>& _flowGraph)
 	{
+		// Every edge yields an arc in each direction; arcs are grouped by tail in generation order, so that antiparallel pairs can be merged before a single bulk insertion
+		constexpr size_t noArc{ std::numeric_limits<size_t>::max () };
+		const size_t verticesCount{ _flowGraph.verticesCount () };
 		ResidualGraph graph;
 		graph.setMatrix (true);
-		graph.addVertices (_flowGraph.verticesCount ());
+		graph.addVertices (verticesCount);
+		std::vector<size_t> firstArcs (verticesCount + 1, 0);
 		for (const FlowGraph<TVD, TED>::Vertex& originalVertex : _flowGraph)
 		{
-			ResidualVertex& vertex{ graph[originalVertex.index ()] };
 			for (const FlowGraph<TVD, TED>::Edge& originalEdge : originalVertex)
 			{
-				ResidualEdge* pExistingEdge{ vertex.outEdgeIfExists (originalEdge.to ().index ()) };
-				ResidualEdge& edge{ pExistingEdge ? *pExistingEdge : vertex.addOutEdge (originalEdge.to ().index ()) };
-				ResidualEdge& reverseEdge{ pExistingEdge ? edge.antiParallel () : graph[originalEdge.to ().index ()].addOutEdge (vertex.index ()) };
-				*edge += originalEdge->residualCapacity ();
-				*reverseEdge += originalEdge->flow ();
+				firstArcs[originalVertex.index () + 1]++;
+				firstArcs[originalEdge.to ().index () + 1]++;
 			}
 		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			firstArcs[v + 1] += firstArcs[v];
+		}
+		std::vector<size_t> heads (firstArcs.back ()), cursors (firstArcs.begin (), firstArcs.end () - 1);
+		std::vector<flow_t> residuals (firstArcs.back ());
+		for (const FlowGraph<TVD, TED>::Vertex& originalVertex : _flowGraph)
+		{
+			const size_t from{ originalVertex.index () };
+			for (const FlowGraph<TVD, TED>::Edge& originalEdge : originalVertex)
+			{
+				const size_t to{ originalEdge.to ().index () };
+				heads[cursors[from]] = to;
+				residuals[cursors[from]++] = originalEdge->residualCapacity ();
+				heads[cursors[to]] = from;
+				residuals[cursors[to]++] = originalEdge->flow ();
+			}
+		}
+		ResidualGraphBuilder builder{ graph };
+		builder.reserve (heads.size ());
+		std::vector<size_t> owners (verticesCount, noArc), firstOccurrences (verticesCount);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			for (size_t a{ firstArcs[v] }; a < firstArcs[v + 1]; a++)
+			{
+				if (owners[heads[a]] == v)
+				{
+					residuals[firstOccurrences[heads[a]]] += residuals[a];
+					heads[a] = noArc;
+				}
+				else
+				{
+					owners[heads[a]] = v;
+					firstOccurrences[heads[a]] = a;
+				}
+			}
+			for (size_t a{ firstArcs[v] }; a < firstArcs[v + 1]; a++)
+			{
+				if (heads[a] != noArc)
+				{
+					builder.addEdge (v, heads[a], residuals[a]);
+				}
+			}
+		}
+		builder.build ();
 		return graph;
 	}
 
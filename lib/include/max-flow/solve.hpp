@@ -4,7 +4,14 @@
 #include <max-flow/graphs/generic/macros.hpp>
 #include <max-flow/graphs/flow.hpp>
 #include <max-flow/graphs/residual.hpp>
+#include <max-flow/graphs/compact_residual.hpp>
+#include <max-flow/graphs/edge_list.hpp>
+#include <max-flow/graphs/algorithms/reduction.hpp>
+#include <max-flow/utils/cancellation_token.hpp>
 #include <type_traits>
+#include <chrono>
+#include <limits>
+#include <vector>
 
 namespace MaxFlow
 {
@@ -25,6 +32,12 @@ namespace MaxFlow
 		CapacityScalingRemoveDeltaEdges = 1 << 1,
 		ShortestPathDetectMinCut = 1 << 2,
 		FordFulkersonDepthFirst = 1 << 3,
+		DischargeFifoWave = 1 << 4,
+		FordFulkersonBidirectional = 1 << 5,
+		// Only honored when solving a FlowGraph, see Graphs::Algorithms::Reduction
+		ReduceGraph = 1 << 6,
+		// Uses the unit capacity solver instead of the requested one when every capacity is 0 or 1
+		DetectUnitCapacities = 1 << 7,
 	};
 
 	struct CapacityMatrix
@@ -52,23 +65,103 @@ namespace MaxFlow
 
 	};
 
+	class EdgeListCapacityMatrix final : public CapacityMatrix
+	{
+
+	private:
+
+		const Graphs::FlowEdgeList& m_edgeList;
+
+	public:
+
+		EdgeListCapacityMatrix (const Graphs::FlowEdgeList& _edgeList);
+
+		Graphs::flow_t capacity (size_t _from, size_t _to) const override;
+
+	};
+
 	class Solver
 	{
 
+	public:
+
+		struct Progress
+		{
+
+			static constexpr Graphs::flow_t unbounded{ std::numeric_limits<Graphs::flow_t>::max () };
+
+			// Value of the current (pre)flow reaching the sink, a lower bound on the maximum flow
+			Graphs::flow_t flow{};
+			// Capacity of a cut known to bound the maximum flow, or unbounded
+			Graphs::flow_t upperBound{ unbounded };
+
+		};
+
+		class ProgressCallback
+		{
+
+			friend class Solver;
+
+			// _solver may be a sub solver of the one the callback was set on
+			virtual void onProgress (const Solver& _solver, const Progress& _progress);
+			// Called after every augmentation of the augmenting path solvers, without waiting for the progress interval
+			virtual void onAugment (const Solver& _solver, Graphs::flow_t _amount);
+
+		public:
+
+			static ProgressCallback none;
+
+		};
+
 	private:
 
 		Graphs::ResidualGraph& m_graph;
 		Graphs::ResidualVertex& m_source, & m_sink;
 		const CapacityMatrix& m_capacities;
 		bool m_areZeroEdgesRemoved;
+		Graphs::CompactResidualGraph m_compactGraph;
+		const Utils::CancellationToken* m_pCancellationToken{};
+		bool m_cancelled{};
+		size_t m_cancellationPolls{};
+		Graphs::flow_t m_flowValue{};
+		bool m_isCompactGraphLoaded{};
+		ProgressCallback* m_pProgressCallback{ &ProgressCallback::none };
+		std::chrono::steady_clock::duration m_progressInterval{ std::chrono::milliseconds{ 100 } };
+		std::chrono::steady_clock::time_point m_nextProgress{};
+		Graphs::flow_t m_terminalCapacity{ Progress::unbounded };
+		std::vector<size_t> m_gapDistanceCounts{};
+
+		void reportProgress ();
 
 	protected:
 
+		// Number of stopRequestedPeriodically calls between two token checks
+		static constexpr size_t cancellationPollInterval{ 1024 };
+
 		virtual void solveImpl () = 0;
 
+		// Must leave a valid flow when returning true; once true, stays true until the next solve
+		// Both also report progress to the callback, at most once per progress interval
+		bool stopRequested ();
+		bool stopRequestedPeriodically ();
+
+		virtual Graphs::flow_t progressFlow ();
+		// Defaults to the smallest of the source and sink cuts
+		virtual Graphs::flow_t progressUpperBound ();
+		// Cut at the lowest empty distance level below the source, saturated as long as the distances are valid for every residual arc
+		Graphs::flow_t gapCutCapacity (const size_t* _distances);
+		void reportAugment (Graphs::flow_t _amount);
+
+		Graphs::CompactResidualGraph& compactGraph ();
+		void loadCompactGraph ();
+		void storeCompactGraph ();
+		// Clears the cancellation and progress state of the previous solve; drivers that run a sub solver without its solve call it first
+		void resetSolveState ();
+
 	public:
 
 		Solver (Graphs::ResidualGraph& _graph, Graphs::ResidualVertex& _source, Graphs::ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix);
+		virtual ~Solver () = default;
 
 		const Graphs::ResidualGraph& graph () const;
 		Graphs::ResidualGraph& graph ();
@@ -81,11 +174,29 @@ namespace MaxFlow
 
 		const CapacityMatrix& capacities () const;
 
+		const Graphs::CompactResidualGraph& compactGraph () const;
+
 		void setRemoveZeroEdges (bool _removeZeroEdge);
 		bool areZeroEdgesRemoved () const;
 
+		const Utils::CancellationToken* cancellationToken () const;
+		void setCancellationToken (const Utils::CancellationToken* _pCancellationToken);
+
 		void solve ();
 
+		// Whether the last solve stopped early; the graph then holds a valid but possibly not maximum flow
+		bool wasCancelled () const;
+
+		// Value of the flow left by the last solve, a lower bound on the maximum flow if it was cancelled
+		Graphs::flow_t flowValue () const;
+
+		const ProgressCallback& progressCallback () const;
+		ProgressCallback& progressCallback ();
+		void setProgressCallback (ProgressCallback& _callback);
+
+		std::chrono::steady_clock::duration progressInterval () const;
+		void setProgressInterval (std::chrono::steady_clock::duration _interval);
+
 	};
 
 	// Enums
@@ -98,8 +209,13 @@ namespace MaxFlow
 		ShortestPath, 
 		NaifPreflowPush, 
 		FifoPreflowPush, 
+		DischargeFifoPreflowPush, 
 		HighestLabelPreflowPush,
-		ExcessScalingPreflowPush
+		ExcessScalingPreflowPush,
+		NaifExcessScalingPreflowPush,
+		UnitCapacity,
+		CapacityScalingFifoPreflowPush,
+		CapacityScalingHighestLabelPreflowPush
 	};
 
 	constexpr ESolver defaultSolver{ ESolver::FordFulkerson };
@@ -114,6 +230,54 @@ namespace MaxFlow
 
 	void solve (Graphs::ResidualGraph& _graph, Graphs::ResidualVertex& _source, Graphs::ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix, ESolver _solver = defaultSolver, ESolverFlags _flags = ESolverFlags::None);
 
+	// Builds the residual graph straight from the list and writes the flows back by arc index
+	void solve (Graphs::FlowEdgeList& _edgeList, size_t _source, size_t _sink, ESolver _solver = defaultSolver, ESolverFlags _flags = ESolverFlags::None);
+
+	// Long-lived solver that keeps its scratch buffers between solves
+	// The solver is only recreated when the graph, terminals or capacity matrix change, so repeatedly solving the same graph does not allocate once the buffers are sized
+
+	class SolverContext final
+	{
+
+	private:
+
+		ESolver m_solver;
+		ESolverFlags m_flags;
+		Solver* m_pSolver{};
+		const Utils::CancellationToken* m_pCancellationToken{};
+		Solver::ProgressCallback* m_pProgressCallback{ &Solver::ProgressCallback::none };
+		std::chrono::steady_clock::duration m_progressInterval{ std::chrono::milliseconds{ 100 } };
+
+	public:
+
+		SolverContext (ESolver _solver = defaultSolver, ESolverFlags _flags = ESolverFlags::None);
+		SolverContext (const SolverContext&) = delete;
+		SolverContext& operator=(const SolverContext&) = delete;
+		~SolverContext ();
+
+		ESolver solver () const;
+		ESolverFlags flags () const;
+
+		const Utils::CancellationToken* cancellationToken () const;
+		void setCancellationToken (const Utils::CancellationToken* _pCancellationToken);
+
+		Solver::ProgressCallback& progressCallback () const;
+		void setProgressCallback (Solver::ProgressCallback& _callback);
+
+		std::chrono::steady_clock::duration progressInterval () const;
+		void setProgressInterval (std::chrono::steady_clock::duration _interval);
+
+		void solve (Graphs::ResidualGraph& _graph, Graphs::ResidualVertex& _source, Graphs::ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix);
+
+		// Result of the last solve
+		bool wasCancelled () const;
+		Graphs::flow_t flowValue () const;
+
+		// Destroys the cached solver and its buffers
+		void clear ();
+
+	};
+
 #pragma endregion
 
 #pragma region Implementation
@@ -121,6 +285,31 @@ namespace MaxFlow
 	MF_GG_TT void solve (Graphs::FlowGraph<TVD, TED>& _graph, Graphs::FlowGraphVertex<TVD, TED>& _source, Graphs::FlowGraphVertex<TVD, TED>& _sink, ESolver _solver, ESolverFlags _flags)
 	{
 		Graphs::Base::Graph::ensureSameGraph (_graph, _source.graph (), _sink.graph ());
+		if (_flags & ESolverFlags::ReduceGraph)
+		{
+			// Edges are listed in iteration order, which is also the order the flows are written back in
+			std::vector<Graphs::FlowEdgeList::Edge> edges{};
+			edges.reserve (_graph.edgesCount ());
+			for (const Graphs::FlowGraphVertex<TVD, TED>& vertex : _graph)
+			{
+				for (const Graphs::FlowGraphEdge<TVD, TED>& edge : vertex)
+				{
+					edges.push_back ({ .from{ vertex.index () }, .to{ edge.to ().index () }, .capacity{ edge->capacity () } });
+				}
+			}
+			Graphs::Algorithms::Reduction reduction{ _graph.verticesCount (), _source.index (), _sink.index (), edges, _solver != ESolver::UnitCapacity };
+			solve (reduction.reduced (), reduction.source (), reduction.sink (), _solver, _flags);
+			const std::vector<Graphs::flow_t> flows{ reduction.originalFlows () };
+			size_t e{ 0 };
+			for (Graphs::FlowGraphVertex<TVD, TED>& vertex : _graph)
+			{
+				for (Graphs::FlowGraphEdge<TVD, TED>& edge : vertex)
+				{
+					edge->setFlow (flows[e++]);
+				}
+			}
+			return;
+		}
 		_graph.setMatrix (true);
 		Graphs::ResidualGraph residualGraph{ Graphs::createResidualGraph (_graph) };
 		residualGraph.setMatrix (true);
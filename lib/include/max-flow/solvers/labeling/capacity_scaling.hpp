@@ -4,6 +4,8 @@
 #include <max-flow/solve.hpp>
 #include <max-flow/solvers/labeling/labeling.hpp>
 #include <max-flow/graphs/algorithms/edge_selector.hpp>
+#include <max-flow/graphs/algorithms/pathfinder.hpp>
+#include <max-flow/graphs/delta_residual_view.hpp>
 
 namespace MaxFlow::Solvers::Labeling
 {
@@ -15,42 +17,46 @@ namespace MaxFlow::Solvers::Labeling
 
 		enum class ESubSolver
 		{
-			FordFulkerson, ShortestPath
+			FordFulkerson, ShortestPath, FifoPreflowPush, HighestLabelPreflowPush
 		};
 
 	private:
 
-		struct PropagateCallback final : public LabelingSolver::Callback
-		{
-
-			Graphs::ResidualGraph& m_graph;
-
-			void onAugment (const LabelingSolver& _solver, Graphs::flow_t _amount);
-
-		public:
-
-			PropagateCallback (Graphs::ResidualGraph& _graph);
-
-		};
-
 		struct DeltaEdgeSelector final : public Graphs::Algorithms::EdgeSelector
 		{
 
 			Graphs::flow_t delta{};
 
-			bool operator() (const Graphs::ResidualEdge& _edge) override;
+			bool operator() (const Graphs::CompactResidualGraph& _graph, size_t _arc) override;
 
 		};
 
 		ESubSolver m_subSolver{ ESubSolver::FordFulkerson};
 		bool m_detectMinCut{ false };
 		bool m_depthFirst{ false };
+		bool m_bidirectional{ false };
 		bool m_removeDeltaEdges{};
+		Graphs::DeltaResidualView m_deltaView{ compactGraph () };
+		Graphs::Algorithms::Pathfinder m_pathfinder{ compactGraph (), source ().index (), sink ().index () };
+		// Kept between solves so that its buffers are reused; recreated when the sub solver changes
+		Solver* m_pSubSolver{};
+		ESubSolver m_subSolverType{};
 
 		void solveImpl () override;
+		void solveWithSubSolver ();
+		void solveOnDeltaView ();
+		void solveShortestPath ();
+		void solvePreflowPush ();
+		// Creates the sub solver if needed and copies the options of this solver to it
+		Solver& subSolverInstance ();
 
 	public:
 
+		using Solver::Solver;
+		CapacityScalingSolver (const CapacityScalingSolver&) = delete;
+		CapacityScalingSolver& operator= (const CapacityScalingSolver&) = delete;
+		~CapacityScalingSolver ();
+
 		bool areDeltaEdgesRemoved () const;
 		void setRemoveDeltaEdges (bool _enabled);
 
@@ -63,7 +69,8 @@ namespace MaxFlow::Solvers::Labeling
 		bool depthFirst() const;
 		void setDepthFirst(bool _depthFirst);
 
-		using Solver::Solver;
+		bool bidirectional() const;
+		void setBidirectional(bool _bidirectional);
 
 	};
 
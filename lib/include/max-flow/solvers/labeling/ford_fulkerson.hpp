@@ -12,6 +12,7 @@ namespace MaxFlow::Solvers::Labeling
 	private:
 
 		bool m_depthFirst{false};
+		bool m_bidirectional{false};
 
 		void solveImpl () override;
 
@@ -20,6 +21,9 @@ namespace MaxFlow::Solvers::Labeling
 		bool depthFirst() const;
 		void setDepthFirst(bool _depthFirst);
 
+		bool bidirectional() const;
+		void setBidirectional(bool _bidirectional);
+
 		using LabelingSolver::LabelingSolver;
 
 	};
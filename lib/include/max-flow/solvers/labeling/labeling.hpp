@@ -4,6 +4,7 @@
 #include <max-flow/solve.hpp>
 #include <max-flow/graphs/algorithms/pathfinder.hpp>
 #include <max-flow/graphs/algorithms/edge_selector.hpp>
+#include <max-flow/graphs/delta_residual_view.hpp>
 
 namespace MaxFlow::Solvers::Labeling
 {
@@ -11,32 +12,19 @@ namespace MaxFlow::Solvers::Labeling
 	class LabelingSolver : public Solver
 	{
 
-	public:
-
-		class Callback
-		{
-
-			friend class LabelingSolver;
-
-			virtual void onAugment (const LabelingSolver& _solver, Graphs::flow_t _amount);
-
-		public:
-
-			static Callback none;
-
-		};
-
 	private:
 
-		Callback* m_pCallback{&Callback::none};
-		Graphs::Algorithms::Pathfinder m_pathfinder{ graph (), source (), sink () };
+		Graphs::Algorithms::Pathfinder m_pathfinder{ compactGraph (), source ().index (), sink ().index () };
 		Graphs::Algorithms::EdgeSelector* m_pEdgeSelector{ &Graphs::Algorithms::EdgeSelector::all };
 
 	protected:
 
 		Graphs::Algorithms::Pathfinder& pathfinder ();
-		void calculatePaths (bool _depthFirst);
+		void calculatePaths (bool _depthFirst, bool _bidirectional = false);
+		// Both report the augmentation to the progress callback
 		void augmentMax ();
+		// Augments through the view, which must be built on the compact graph
+		void augmentMax (Graphs::DeltaResidualView& _deltaView);
 
 	public:
 
@@ -46,10 +34,6 @@ namespace MaxFlow::Solvers::Labeling
 		Graphs::Algorithms::EdgeSelector& edgeSelector ();
 		void setEdgeSelector (Graphs::Algorithms::EdgeSelector& _edgeSelector);
 
-		const Callback& callback () const;
-		Callback& callback ();
-		void setCallback (Callback& _callback);
-
 		using Solver::Solver;
 
 	};
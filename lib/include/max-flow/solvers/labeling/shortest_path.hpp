@@ -3,6 +3,7 @@
 
 #include <max-flow/solvers/labeling/labeling.hpp>
 #include <max-flow/graphs/algorithms/distance_labeler.hpp>
+#include <max-flow/graphs/delta_residual_view.hpp>
 #include <vector>
 
 namespace MaxFlow::Solvers::Labeling
@@ -13,11 +14,24 @@ namespace MaxFlow::Solvers::Labeling
 
 	private:
 
-		Graphs::Algorithms::DistanceLabeler m_distanceLabeler{ graph (), source (), sink () };
+		friend class CapacityScalingSolver;
+
+		Graphs::Algorithms::DistanceLabeler m_distanceLabeler{ compactGraph (), source ().index (), sink ().index () };
 		std::vector<size_t> m_distanceCounts{};
+		// Per vertex offset of the next arc to examine in its arc list; the arcs before it are not admissible until the vertex is relabeled
+		std::vector<size_t> m_currentArcs{};
+		// When set, only the eligible arcs of the view are used, one capacity scaling phase at a time
+		Graphs::DeltaResidualView* m_pDeltaView{};
 		bool m_detectMinCut{ false };
 
 		void solveImpl () override;
+		Graphs::flow_t progressUpperBound () override;
+		void prepare (Graphs::Algorithms::EdgeSelector& _edgeSelector);
+		void prepare (Graphs::DeltaResidualView& _deltaView);
+		// Advances and retreats along admissible arcs until the source is cut off from the sink
+		void run ();
+		size_t findAdmissibleArc (size_t _vertex, size_t _distance);
+		size_t minNeighborDistance (size_t _vertex);
 
 	public:
 
@@ -0,0 +1,45 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_LABELING_UNIT_CAPACITY
+#define INCLUDED_MAX_FLOW_SOLVERS_LABELING_UNIT_CAPACITY
+
+#include <max-flow/solve.hpp>
+#include <vector>
+
+namespace MaxFlow::Solvers::Labeling
+{
+
+	class UnitCapacitySolver final : public Solver
+	{
+
+	private:
+
+		// Arc a goes from m_tails[a] to m_heads[a]
+		// Half arc 2a is its forward residual arc, half arc 2a+1 its backward residual arc
+
+		std::vector<size_t> m_tails{}, m_heads{};
+		std::vector<bool> m_flows{};
+		std::vector<size_t> m_firstHalfArcs{}, m_halfArcs{}, m_currentHalfArcs{};
+		std::vector<size_t> m_levels{}, m_queue{}, m_path{};
+
+		void solveImpl () override;
+		Graphs::flow_t progressFlow () override;
+
+		void build ();
+		void writeBack ();
+		bool calculateLevels ();
+		bool augment ();
+
+		size_t from (size_t _halfArc) const;
+		size_t to (size_t _halfArc) const;
+		bool isResidual (size_t _halfArc) const;
+
+	public:
+
+		static bool hasUnitCapacities (const Graphs::ResidualGraph& _graph, const CapacityMatrix& _capacityMatrix);
+
+		using Solver::Solver;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
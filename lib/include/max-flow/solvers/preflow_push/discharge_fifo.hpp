@@ -0,0 +1,47 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_DISCHARGE_FIFO
+#define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_DISCHARGE_FIFO
+
+#include <max-flow/solvers/preflow_push/preflow_push.hpp>
+#include <max-flow/solvers/preflow_push/vertex_queue.hpp>
+#include <vector>
+#include <limits>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	// FIFO preflow-push that fully discharges each selected vertex; in wave mode vertices are instead discharged in passes over a list kept in topological order of the admissible arcs, moving relabeled vertices to the front
+
+	class DischargeFifoPreflowPushSolver final : public PreflowPushSolver
+	{
+
+	private:
+
+		static constexpr size_t none{ std::numeric_limits<size_t>::max () };
+
+		std::vector<Graphs::flow_t> m_excesses{};
+		VertexQueue m_activeVertices{};
+		std::vector<size_t> m_next{}, m_previous{}, m_order{};
+		size_t m_first{ none };
+		bool m_wave{ false };
+
+		void initialize () override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
+		Excess getExcess () override;
+		void run () override;
+
+		void runFifo ();
+		void runWave ();
+		void moveToFront (size_t _vertex);
+
+	public:
+
+		bool wave () const;
+		void setWave (bool _wave);
+
+		using PreflowPushSolver::PreflowPushSolver;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 #define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_EXCESS_SCALING
 
 #include <max-flow/solvers/preflow_push/preflow_push.hpp>
-#include <queue>
+#include <max-flow/solvers/preflow_push/label_buckets.hpp>
 #include <vector>
 
 namespace MaxFlow::Solvers::PreflowPush
@@ -13,18 +13,20 @@ namespace MaxFlow::Solvers::PreflowPush
 
 	private:
 
+		// Vertices with excess greater than delta / 2 are active in m_largeExcesses, indexed by label
+		// The others with positive excess are in m_smallExcesses, indexed by the ceiling of the log2 of their excess
+
 		std::vector<Graphs::flow_t> m_excesses{};
-		std::vector<std::queue<Graphs::ResidualVertex*>> m_activeVerticesPerDistance{};
-		size_t m_minDistance{};
-		Graphs::flow_t m_delta;
+		LabelBuckets m_largeExcesses{}, m_smallExcesses{};
+		Graphs::flow_t m_delta{};
 
 		void initialize () override;
-		void addExcess (Graphs::ResidualEdge& _edge, Graphs::flow_t _amount) override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
 		Excess getExcess () override;
-		void onRelabel (Graphs::ResidualVertex& _vertex, size_t _oldDistance) override;
-		void push (Graphs::ResidualVertex& _vertex);
-		Graphs::flow_t maximumPushAmount (const Graphs::ResidualEdge& _edge, Excess _fromExcess) const override;
-		void updateActiveNodes ();
+		void onRelabel (size_t _vertex, size_t _oldDistance) override;
+		Graphs::flow_t maximumPushAmount (size_t _arc, Excess _fromExcess) const override;
+		void updateExcess (size_t _vertex);
+		bool isTerminal (size_t _vertex) const;
 
 	public:
 
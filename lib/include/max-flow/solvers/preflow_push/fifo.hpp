@@ -2,7 +2,7 @@
 #define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_FIFO
 
 #include <max-flow/solvers/preflow_push/preflow_push.hpp>
-#include <queue>
+#include <max-flow/solvers/preflow_push/vertex_queue.hpp>
 #include <vector>
 
 namespace MaxFlow::Solvers::PreflowPush
@@ -14,11 +14,12 @@ namespace MaxFlow::Solvers::PreflowPush
 	private:
 
 		std::vector<Graphs::flow_t> m_excesses{};
-		std::queue<Graphs::ResidualVertex*> m_activeVertices{};
+		VertexQueue m_activeVertices{};
 
 		void initialize () override;
-		void addExcess (Graphs::ResidualEdge& _edge, Graphs::flow_t _amount) override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
 		Excess getExcess () override;
+		void setActive (size_t _vertex, bool _active) override;
 
 	public:
 
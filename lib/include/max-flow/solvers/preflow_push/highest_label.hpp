@@ -2,7 +2,7 @@
 #define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_HIGHEST_LABEL
 
 #include <max-flow/solvers/preflow_push/preflow_push.hpp>
-#include <queue>
+#include <max-flow/solvers/preflow_push/label_buckets.hpp>
 #include <vector>
 
 namespace MaxFlow::Solvers::PreflowPush
@@ -14,14 +14,13 @@ namespace MaxFlow::Solvers::PreflowPush
 	private:
 
 		std::vector<Graphs::flow_t> m_excesses{};
-		std::vector<std::queue<Graphs::ResidualVertex*>> m_activeVerticesPerDistance{};
-		size_t m_maxDistance{};
+		LabelBuckets m_buckets{};
 
 		void initialize () override;
-		void addExcess (Graphs::ResidualEdge& _edge, Graphs::flow_t _amount) override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
 		Excess getExcess () override;
-		void onRelabel(Graphs::ResidualVertex& _vertex, size_t _oldDistance) override;
-		void push (Graphs::ResidualVertex& _vertex);
+		void onRelabel(size_t _vertex, size_t _oldDistance) override;
+		void setActive(size_t _vertex, bool _active) override;
 
 	public:
 
@@ -0,0 +1,184 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_LABEL_BUCKETS
+#define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_LABEL_BUCKETS
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+#pragma region Declaration
+
+	// Vertices indexed by distance label, each bucket holding an active and an inactive intrusive doubly linked list
+
+	class LabelBuckets final
+	{
+
+	public:
+
+		static constexpr size_t none{ std::numeric_limits<size_t>::max () };
+
+	private:
+
+		struct Bucket
+		{
+
+			size_t firstActive{ none }, firstInactive{ none };
+
+		};
+
+		struct Node
+		{
+
+			size_t next{ none }, previous{ none }, label{ none };
+			bool active{};
+
+		};
+
+		std::vector<Bucket> m_buckets{};
+		std::vector<Node> m_nodes{};
+		size_t m_maxActiveLabel{ none }, m_minActiveLabel{ none };
+
+		size_t& first (size_t _label, bool _active);
+
+	public:
+
+		void reset (size_t _verticesCount, size_t _labelsCount);
+
+		// Modifiers
+
+		void insert (size_t _vertex, size_t _label, bool _active);
+		void remove (size_t _vertex);
+		void setActive (size_t _vertex, bool _active);
+		void relabel (size_t _vertex, size_t _label);
+
+		// Getters
+
+		bool contains (size_t _vertex) const;
+		bool isActive (size_t _vertex) const;
+		size_t label (size_t _vertex) const;
+		size_t labelsCount () const;
+
+		size_t firstActive (size_t _label) const;
+		size_t firstInactive (size_t _label) const;
+		size_t next (size_t _vertex) const;
+
+		// Selection
+
+		size_t highestActive ();
+		size_t lowestActive ();
+
+	};
+
+#pragma endregion
+
+#pragma region Implementation
+
+	inline size_t& LabelBuckets::first (size_t _label, bool _active)
+	{
+		return _active ? m_buckets[_label].firstActive : m_buckets[_label].firstInactive;
+	}
+
+	inline void LabelBuckets::insert (size_t _vertex, size_t _label, bool _active)
+	{
+		Node& node{ m_nodes[_vertex] };
+		size_t& head{ first (_label, _active) };
+		node.label = _label;
+		node.active = _active;
+		node.previous = none;
+		node.next = head;
+		if (head != none)
+		{
+			m_nodes[head].previous = _vertex;
+		}
+		head = _vertex;
+		if (_active)
+		{
+			if (m_maxActiveLabel == none || _label > m_maxActiveLabel)
+			{
+				m_maxActiveLabel = _label;
+			}
+			if (m_minActiveLabel == none || _label < m_minActiveLabel)
+			{
+				m_minActiveLabel = _label;
+			}
+		}
+	}
+
+	inline void LabelBuckets::remove (size_t _vertex)
+	{
+		Node& node{ m_nodes[_vertex] };
+		if (node.previous != none)
+		{
+			m_nodes[node.previous].next = node.next;
+		}
+		else
+		{
+			first (node.label, node.active) = node.next;
+		}
+		if (node.next != none)
+		{
+			m_nodes[node.next].previous = node.previous;
+		}
+		node = {};
+	}
+
+	inline void LabelBuckets::setActive (size_t _vertex, bool _active)
+	{
+		const Node& node{ m_nodes[_vertex] };
+		if (node.active != _active)
+		{
+			const size_t label{ node.label };
+			remove (_vertex);
+			insert (_vertex, label, _active);
+		}
+	}
+
+	inline void LabelBuckets::relabel (size_t _vertex, size_t _label)
+	{
+		const bool active{ m_nodes[_vertex].active };
+		remove (_vertex);
+		insert (_vertex, _label, active);
+	}
+
+	inline bool LabelBuckets::contains (size_t _vertex) const
+	{
+		return m_nodes[_vertex].label != none;
+	}
+
+	inline bool LabelBuckets::isActive (size_t _vertex) const
+	{
+		return m_nodes[_vertex].active;
+	}
+
+	inline size_t LabelBuckets::label (size_t _vertex) const
+	{
+		return m_nodes[_vertex].label;
+	}
+
+	inline size_t LabelBuckets::labelsCount () const
+	{
+		return m_buckets.size ();
+	}
+
+	inline size_t LabelBuckets::firstActive (size_t _label) const
+	{
+		return m_buckets[_label].firstActive;
+	}
+
+	inline size_t LabelBuckets::firstInactive (size_t _label) const
+	{
+		return m_buckets[_label].firstInactive;
+	}
+
+	inline size_t LabelBuckets::next (size_t _vertex) const
+	{
+		return m_nodes[_vertex].next;
+	}
+
+#pragma endregion
+
+}
+
+#endif
\ No newline at end of file
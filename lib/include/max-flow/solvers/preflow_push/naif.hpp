@@ -15,7 +15,7 @@ namespace MaxFlow::Solvers::PreflowPush
 		std::vector<Graphs::flow_t> m_excesses{};
 
 		void initialize () override;
-		void addExcess (Graphs::ResidualEdge& _edge, Graphs::flow_t _amount) override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
 		Excess getExcess () override;
 
 	public:
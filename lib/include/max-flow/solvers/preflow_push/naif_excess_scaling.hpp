@@ -0,0 +1,35 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_NAIF_EXCESS_SCALING
+#define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_NAIF_EXCESS_SCALING
+
+#include <max-flow/solvers/preflow_push/preflow_push.hpp>
+#include <max-flow/solvers/preflow_push/label_buckets.hpp>
+#include <vector>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	class NaifExcessScalingPreflowPushSolver final : public PreflowPushSolver
+	{
+
+	private:
+
+		std::vector<Graphs::flow_t> m_excesses{};
+		LabelBuckets m_buckets{};
+		Graphs::flow_t m_delta;
+
+		void initialize () override;
+		void addExcess (size_t _arc, Graphs::flow_t _amount) override;
+		Excess getExcess () override;
+		void onRelabel (size_t _vertex, size_t _oldDistance) override;
+		Graphs::flow_t maximumPushAmount (size_t _arc, Excess _fromExcess) const override;
+		void updateActiveNodes ();
+
+	public:
+
+		using PreflowPushSolver::PreflowPushSolver;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_PARAMETRIC
+#define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_PARAMETRIC
+
+#include <max-flow/solve.hpp>
+#include <max-flow/solvers/preflow_push/preflow_push.hpp>
+#include <max-flow/graphs/algorithms/distance_labeler.hpp>
+#include <vector>
+#include <limits>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	struct ParametricCapacities
+	{
+
+		// Nondecreasing in _parameter
+		virtual Graphs::flow_t sourceCapacity (size_t _to, double _parameter) const = 0;
+
+		// Nonincreasing in _parameter
+		virtual Graphs::flow_t sinkCapacity (size_t _from, double _parameter) const = 0;
+
+	};
+
+	class ParametricPreflowPushSolver final : public Solver
+	{
+
+	public:
+
+		enum class ESubSolver
+		{
+			FifoPreflowPush, HighestLabelPreflowPush
+		};
+
+		// Maximum flow and maximal min cut source side at one of the supplied parameters
+		// The cuts are only sampled there: a change of the cut between two parameters shows up at the later one
+		struct ParameterCut
+		{
+
+			double parameter{};
+			Graphs::flow_t flow{};
+			size_t sourceSideVerticesCount{};
+
+		};
+
+		static constexpr size_t noParameterCut{ std::numeric_limits<size_t>::max () };
+
+	private:
+
+		const ParametricCapacities& m_parametricCapacities;
+		ESubSolver m_subSolver{ ESubSolver::HighestLabelPreflowPush };
+		std::vector<double> m_parameters{};
+		std::vector<Graphs::flow_t> m_sourceCapacities{}, m_sinkCapacities{};
+		std::vector<ParameterCut> m_parameterCuts{};
+		std::vector<size_t> m_vertexParameterCuts{};
+		Graphs::flow_t m_currentFlow{};
+		// Kept between solves so that its buffers are reused; recreated when the sub solver changes
+		PreflowPushSolver* m_pSubSolver{};
+		ESubSolver m_subSolverType{};
+
+		void solveImpl () override;
+		Graphs::flow_t progressFlow () override;
+		Graphs::flow_t progressUpperBound () override;
+		void setTerminalCapacities (double _firstParameter, double _lastParameter);
+		void updateTerminalCapacities (PreflowPushSolver& _subSolver, double _parameter);
+		Graphs::flow_t flow (const Graphs::CompactResidualGraph& _graph) const;
+		void addParameterCut (const Graphs::CompactResidualGraph& _graph, double _parameter);
+		PreflowPushSolver& subSolverInstance ();
+
+	public:
+
+		ParametricPreflowPushSolver (Graphs::ResidualGraph& _graph, Graphs::ResidualVertex& _source, Graphs::ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix, const ParametricCapacities& _parametricCapacities);
+		ParametricPreflowPushSolver (const ParametricPreflowPushSolver&) = delete;
+		ParametricPreflowPushSolver& operator= (const ParametricPreflowPushSolver&) = delete;
+		~ParametricPreflowPushSolver ();
+
+		const ParametricCapacities& parametricCapacities () const;
+
+		const std::vector<double>& parameters () const;
+		void setParameters (const std::vector<double>& _parameters);
+
+		ESubSolver subSolver () const;
+		void setSubSolver (ESubSolver _subSolver);
+
+		// One per solved parameter, in order
+		const std::vector<ParameterCut>& parameterCuts () const;
+		// Index of the first parameter cut with the vertex on the source side, or noParameterCut
+		size_t firstSourceSideCut (const Graphs::ResidualVertex& _vertex) const;
+
+	};
+
+}
+
+#endif
\ No newline at end of file
@@ -3,6 +3,15 @@
 
 #include <max-flow/solve.hpp>
 #include <max-flow/graphs/algorithms/distance_labeler.hpp>
+#include <max-flow/graphs/delta_residual_view.hpp>
+#include <vector>
+
+namespace MaxFlow::Solvers::Labeling
+{
+
+	class CapacityScalingSolver;
+
+}
 
 namespace MaxFlow::Solvers::PreflowPush
 {
@@ -12,16 +21,44 @@ namespace MaxFlow::Solvers::PreflowPush
 
 	private:
 
-		Graphs::Algorithms::DistanceLabeler m_distanceLabeler{ graph (), source (), sink () };
+		friend class ParametricPreflowPushSolver;
+		friend class Labeling::CapacityScalingSolver;
+
+		Graphs::Algorithms::DistanceLabeler m_distanceLabeler{ compactGraph (), source ().index (), sink ().index () };
+		// When set, only the active arcs of the view are used, one capacity scaling phase at a time
+		Graphs::DeltaResidualView* m_pDeltaView{};
+		std::vector<size_t> m_repairQueue{};
+		std::vector<size_t> m_returnPredecessors{};
+		// Per vertex offset of the next arc to examine in its arc list; the arcs before it are not admissible until the vertex is relabeled
+		std::vector<size_t> m_currentArcs{};
+		// Vertices of a scaling phase whose excess can no longer reach the sink through the active arcs; they are resumed by the next phase
+		std::vector<size_t> m_parkedVertices{};
+		// Number of vertices at each label below the vertices count, only kept during scaling phases
+		std::vector<size_t> m_labelCounts{};
 
 		void solveImpl () override final;
+		Graphs::flow_t progressUpperBound () override;
+		void prepare ();
+		void prepare (Graphs::DeltaResidualView& _deltaView);
+		void repairLabels (const std::vector<size_t>& _arcs);
+		void resetCurrentArcs ();
+		void countLabels ();
+		// Updates the label counts after a relabel; when the old label is left empty, the vertices above it are lifted to the vertices count
+		void liftAboveGap (size_t _vertex, size_t _oldDistance);
+		// Resumes from the current arc of the vertex and leaves it on the returned arc
+		size_t findAdmissibleArc (size_t _vertex);
+		size_t minNeighborDistance (size_t _vertex) const;
+		// Turns the preflow left by an interrupted run into a valid flow
+		void returnExcess ();
+		void saturate (size_t _arc);
+		void saturateSourceEdges ();
 
 	protected:
 
 		struct Excess
 		{
 
-			Graphs::ResidualVertex* pVertex{};
+			size_t vertex{};
 			Graphs::flow_t amount{};
 
 			bool isExcess () const;
@@ -29,12 +66,21 @@ namespace MaxFlow::Solvers::PreflowPush
 		};
 
 		virtual void initialize () = 0;
-		virtual void addExcess (Graphs::ResidualEdge& _edge, Graphs::flow_t _amount) = 0;
+		virtual void addExcess (size_t _arc, Graphs::flow_t _amount) = 0;
 		virtual Excess getExcess () = 0;
-		virtual void onRelabel (Graphs::ResidualVertex& _vertex, size_t _oldLabel);
-		virtual Graphs::flow_t maximumPushAmount (const Graphs::ResidualEdge& _edge, Excess _fromExcess) const;
+		virtual void onRelabel (size_t _vertex, size_t _oldLabel);
+		// Only needed by the engines driven through scaling phases; deactivation is only asked for the vertex returned by the last getExcess
+		virtual void setActive (size_t _vertex, bool _active);
+		virtual Graphs::flow_t maximumPushAmount (size_t _arc, Excess _fromExcess) const;
+
+		virtual void run ();
+
+		void push (size_t _arc, Graphs::flow_t _amount);
+		void relabel (size_t _vertex);
+		// Pushes along admissible arcs, resuming from the current arc, and relabels until the vertex has no excess left; returns whether it was relabeled
+		bool discharge (Excess _excess);
 
-		Graphs::Algorithms::DistanceLabeler::Label label (const Graphs::ResidualVertex& _vertex) const;
+		Graphs::Algorithms::DistanceLabeler::Label label (size_t _vertex) const;
 
 	public:
 
@@ -0,0 +1,93 @@
+#ifndef INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_VERTEX_QUEUE
+#define INCLUDED_MAX_FLOW_SOLVERS_PREFLOW_PUSH_VERTEX_QUEUE
+
+#include <vector>
+#include <cstddef>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+#pragma region Declaration
+
+	// FIFO queue of distinct vertices, stored in a ring buffer sized to the graph so that pushing never allocates
+
+	class VertexQueue final
+	{
+
+	private:
+
+		std::vector<size_t> m_vertices{};
+		std::vector<bool> m_queued{};
+		size_t m_front{}, m_size{};
+
+	public:
+
+		void reset (size_t _verticesCount);
+
+		// Modifiers
+
+		void push (size_t _vertex);
+		void pop ();
+
+		// Getters
+
+		bool empty () const;
+		size_t size () const;
+		size_t front () const;
+		bool contains (size_t _vertex) const;
+
+	};
+
+#pragma endregion
+
+#pragma region Implementation
+
+	inline void VertexQueue::push (size_t _vertex)
+	{
+		if (!m_queued[_vertex])
+		{
+			m_queued[_vertex] = true;
+			size_t back{ m_front + m_size++ };
+			if (back >= m_vertices.size ())
+			{
+				back -= m_vertices.size ();
+			}
+			m_vertices[back] = _vertex;
+		}
+	}
+
+	inline void VertexQueue::pop ()
+	{
+		m_queued[m_vertices[m_front]] = false;
+		if (++m_front == m_vertices.size ())
+		{
+			m_front = 0;
+		}
+		m_size--;
+	}
+
+	inline bool VertexQueue::empty () const
+	{
+		return !m_size;
+	}
+
+	inline size_t VertexQueue::size () const
+	{
+		return m_size;
+	}
+
+	inline size_t VertexQueue::front () const
+	{
+		return m_vertices[m_front];
+	}
+
+	inline bool VertexQueue::contains (size_t _vertex) const
+	{
+		return m_queued[_vertex];
+	}
+
+#pragma endregion
+
+}
+
+#endif
\ No newline at end of file
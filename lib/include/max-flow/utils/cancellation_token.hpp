@@ -0,0 +1,87 @@
+#ifndef INCLUDED_MAX_FLOW_UTILS_CANCELLATION_TOKEN
+#define INCLUDED_MAX_FLOW_UTILS_CANCELLATION_TOKEN
+
+#include <atomic>
+#include <chrono>
+
+namespace MaxFlow::Utils
+{
+
+#pragma region Declaration
+
+	// Stop request shared with a running solver, either explicit through cancel or implicit once the deadline has passed
+	// cancel may be called from any thread
+
+	class CancellationToken final
+	{
+
+	public:
+
+		using Clock = std::chrono::steady_clock;
+
+	private:
+
+		std::atomic<bool> m_cancelled{ false };
+		Clock::time_point m_deadline{ Clock::time_point::max () };
+
+	public:
+
+		// Construction
+
+		CancellationToken () = default;
+		explicit CancellationToken (Clock::time_point _deadline);
+		explicit CancellationToken (Clock::duration _budget);
+
+		// Modifiers
+
+		void cancel ();
+		void setDeadline (Clock::time_point _deadline);
+		void setBudget (Clock::duration _budget);
+
+		// Getters
+
+		Clock::time_point deadline () const;
+		bool isCancelled () const;
+
+	};
+
+#pragma endregion
+
+#pragma region Implementation
+
+	inline CancellationToken::CancellationToken (Clock::time_point _deadline) : m_deadline{ _deadline }
+	{}
+
+	inline CancellationToken::CancellationToken (Clock::duration _budget) : m_deadline{ Clock::now () + _budget }
+	{}
+
+	inline void CancellationToken::cancel ()
+	{
+		m_cancelled.store (true, std::memory_order_relaxed);
+	}
+
+	inline void CancellationToken::setDeadline (Clock::time_point _deadline)
+	{
+		m_deadline = _deadline;
+	}
+
+	inline void CancellationToken::setBudget (Clock::duration _budget)
+	{
+		m_deadline = Clock::now () + _budget;
+	}
+
+	inline CancellationToken::Clock::time_point CancellationToken::deadline () const
+	{
+		return m_deadline;
+	}
+
+	inline bool CancellationToken::isCancelled () const
+	{
+		return m_cancelled.load (std::memory_order_relaxed) || (m_deadline != Clock::time_point::max () && Clock::now () >= m_deadline);
+	}
+
+#pragma endregion
+
+}
+
+#endif
\ No newline at end of file
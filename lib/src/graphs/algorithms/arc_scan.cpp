@@ -0,0 +1,272 @@
+#include <max-flow/graphs/algorithms/arc_scan.hpp>
+
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MF_ARC_SCAN_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(MF_ARC_SCAN_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MF_ARC_SCAN_TARGET(_target) __attribute__ ((target (_target)))
+#else
+#define MF_ARC_SCAN_TARGET(_target)
+#endif
+
+namespace MaxFlow::Graphs::Algorithms
+{
+
+	namespace
+	{
+
+		constexpr size_t noArc{ CompactResidualGraph::noArc };
+		constexpr size_t maxDistance{ std::numeric_limits<size_t>::max () };
+
+#pragma region Scalar
+
+		size_t findArcToDistanceScalar (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end, size_t _distance)
+		{
+			for (size_t arc{ _begin }; arc < _end; arc++)
+			{
+				if (_residuals[arc] && _distances[_heads[arc]] == _distance)
+				{
+					return arc;
+				}
+			}
+			return noArc;
+		}
+
+		size_t minHeadDistanceScalar (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end)
+		{
+			size_t minDistance{ maxDistance };
+			for (size_t arc{ _begin }; arc < _end; arc++)
+			{
+				if (_residuals[arc] && _distances[_heads[arc]] < minDistance)
+				{
+					minDistance = _distances[_heads[arc]];
+				}
+			}
+			return minDistance;
+		}
+
+#pragma endregion
+
+#ifdef MF_ARC_SCAN_X86
+
+		static_assert(sizeof (size_t) == 8 && sizeof (flow_t) == 8, "64 bit lanes expected");
+
+#pragma region AVX2
+
+		MF_ARC_SCAN_TARGET ("avx2") size_t findArcToDistanceAVX2 (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end, size_t _distance)
+		{
+			const __m256i zero{ _mm256_setzero_si256 () };
+			const __m256i distance{ _mm256_set1_epi64x (static_cast<long long>(_distance)) };
+			size_t arc{ _begin };
+			for (; arc + 4 <= _end; arc += 4)
+			{
+				const __m256i heads{ _mm256_loadu_si256 (reinterpret_cast<const __m256i*>(_heads + arc)) };
+				const __m256i residuals{ _mm256_loadu_si256 (reinterpret_cast<const __m256i*>(_residuals + arc)) };
+				const __m256i distances{ _mm256_i64gather_epi64 (reinterpret_cast<const long long*>(_distances), heads, 8) };
+				const __m256i matches{ _mm256_andnot_si256 (_mm256_cmpeq_epi64 (residuals, zero), _mm256_cmpeq_epi64 (distances, distance)) };
+				const unsigned int mask{ static_cast<unsigned int>(_mm256_movemask_pd (_mm256_castsi256_pd (matches))) };
+				if (mask)
+				{
+					return arc + std::countr_zero (mask);
+				}
+			}
+			return findArcToDistanceScalar (_heads, _residuals, _distances, arc, _end, _distance);
+		}
+
+		MF_ARC_SCAN_TARGET ("avx2") size_t minHeadDistanceAVX2 (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end)
+		{
+			// No unsigned 64 bit min in AVX2: compare with flipped sign bits
+			const __m256i zero{ _mm256_setzero_si256 () };
+			const __m256i signBit{ _mm256_set1_epi64x (std::numeric_limits<long long>::min ()) };
+			__m256i minDistances{ _mm256_set1_epi64x (-1) };
+			size_t arc{ _begin };
+			for (; arc + 4 <= _end; arc += 4)
+			{
+				const __m256i heads{ _mm256_loadu_si256 (reinterpret_cast<const __m256i*>(_heads + arc)) };
+				const __m256i residuals{ _mm256_loadu_si256 (reinterpret_cast<const __m256i*>(_residuals + arc)) };
+				const __m256i distances{ _mm256_i64gather_epi64 (reinterpret_cast<const long long*>(_distances), heads, 8) };
+				const __m256i candidates{ _mm256_or_si256 (distances, _mm256_cmpeq_epi64 (residuals, zero)) };
+				const __m256i smaller{ _mm256_cmpgt_epi64 (_mm256_xor_si256 (minDistances, signBit), _mm256_xor_si256 (candidates, signBit)) };
+				minDistances = _mm256_blendv_epi8 (minDistances, candidates, smaller);
+			}
+			alignas(32) size_t lanes[4];
+			_mm256_store_si256 (reinterpret_cast<__m256i*>(lanes), minDistances);
+			size_t minDistance{ minHeadDistanceScalar (_heads, _residuals, _distances, arc, _end) };
+			for (const size_t lane : lanes)
+			{
+				if (lane < minDistance)
+				{
+					minDistance = lane;
+				}
+			}
+			return minDistance;
+		}
+
+#pragma endregion
+
+#pragma region AVX512
+
+		MF_ARC_SCAN_TARGET ("avx512f") size_t findArcToDistanceAVX512 (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end, size_t _distance)
+		{
+			const __m512i distance{ _mm512_set1_epi64 (static_cast<long long>(_distance)) };
+			size_t arc{ _begin };
+			for (; arc + 8 <= _end; arc += 8)
+			{
+				const __m512i residuals{ _mm512_loadu_si512 (_residuals + arc) };
+				const __mmask8 residual{ _mm512_test_epi64_mask (residuals, residuals) };
+				if (residual)
+				{
+					const __m512i heads{ _mm512_loadu_si512 (_heads + arc) };
+					const __m512i distances{ _mm512_mask_i64gather_epi64 (_mm512_setzero_si512 (), residual, heads, _distances, 8) };
+					const __mmask8 matches{ _mm512_mask_cmpeq_epu64_mask (residual, distances, distance) };
+					if (matches)
+					{
+						return arc + std::countr_zero (static_cast<unsigned int>(matches));
+					}
+				}
+			}
+			return findArcToDistanceScalar (_heads, _residuals, _distances, arc, _end, _distance);
+		}
+
+		MF_ARC_SCAN_TARGET ("avx512f") size_t minHeadDistanceAVX512 (const size_t* _heads, const flow_t* _residuals, const size_t* _distances, size_t _begin, size_t _end)
+		{
+			const __m512i none{ _mm512_set1_epi64 (-1) };
+			__m512i minDistances{ none };
+			size_t arc{ _begin };
+			for (; arc + 8 <= _end; arc += 8)
+			{
+				const __m512i residuals{ _mm512_loadu_si512 (_residuals + arc) };
+				const __mmask8 residual{ _mm512_test_epi64_mask (residuals, residuals) };
+				const __m512i heads{ _mm512_loadu_si512 (_heads + arc) };
+				const __m512i distances{ _mm512_mask_i64gather_epi64 (none, residual, heads, _distances, 8) };
+				minDistances = _mm512_min_epu64 (minDistances, distances);
+			}
+			const size_t minDistance{ minHeadDistanceScalar (_heads, _residuals, _distances, arc, _end) };
+			const size_t minLane{ static_cast<size_t>(_mm512_reduce_min_epu64 (minDistances)) };
+			return minLane < minDistance ? minLane : minDistance;
+		}
+
+#pragma endregion
+
+#endif
+
+#pragma region Dispatch
+
+		bool isSupported (EArcScanKernel _kernel)
+		{
+			switch (_kernel)
+			{
+				case EArcScanKernel::Scalar:
+					return true;
+#ifdef MF_ARC_SCAN_X86
+#ifdef _MSC_VER
+				case EArcScanKernel::AVX2:
+				case EArcScanKernel::AVX512:
+				{
+					int info[4];
+					__cpuid (info, 1);
+					if (!(info[2] & (1 << 27)))
+					{
+						return false;
+					}
+					const unsigned long long xcr0{ _xgetbv (0) };
+					__cpuidex (info, 7, 0);
+					if (_kernel == EArcScanKernel::AVX2)
+					{
+						return (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5));
+					}
+					return (xcr0 & 0xe6) == 0xe6 && (info[1] & (1 << 16));
+				}
+#else
+				case EArcScanKernel::AVX2:
+					__builtin_cpu_init ();
+					return __builtin_cpu_supports ("avx2");
+				case EArcScanKernel::AVX512:
+					__builtin_cpu_init ();
+					return __builtin_cpu_supports ("avx512f");
+#endif
+#endif
+				default:
+					return false;
+			}
+		}
+
+		EArcScanKernel detectKernel ()
+		{
+			for (const EArcScanKernel kernel : { EArcScanKernel::AVX512, EArcScanKernel::AVX2 })
+			{
+				if (isSupported (kernel))
+				{
+					return kernel;
+				}
+			}
+			return EArcScanKernel::Scalar;
+		}
+
+		EArcScanKernel s_kernel{ detectKernel () };
+
+#pragma endregion
+
+	}
+
+	EArcScanKernel arcScanKernel ()
+	{
+		return s_kernel;
+	}
+
+	void setArcScanKernel (EArcScanKernel _kernel)
+	{
+		if (!isSupported (_kernel))
+		{
+			throw std::invalid_argument{ "unsupported kernel" };
+		}
+		s_kernel = _kernel;
+	}
+
+	size_t findArcToDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex, size_t _distance)
+	{
+		return findArcToDistance (_graph, _distances, _vertex, _distance, _graph.firstArc (_vertex));
+	}
+
+	size_t findArcToDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex, size_t _distance, size_t _firstArc)
+	{
+		const size_t begin{ _firstArc }, end{ _graph.endArc (_vertex) };
+		switch (s_kernel)
+		{
+#ifdef MF_ARC_SCAN_X86
+			case EArcScanKernel::AVX512:
+				return findArcToDistanceAVX512 (_graph.heads (), _graph.residuals (), _distances, begin, end, _distance);
+			case EArcScanKernel::AVX2:
+				return findArcToDistanceAVX2 (_graph.heads (), _graph.residuals (), _distances, begin, end, _distance);
+#endif
+			default:
+				return findArcToDistanceScalar (_graph.heads (), _graph.residuals (), _distances, begin, end, _distance);
+		}
+	}
+
+	size_t minHeadDistance (const CompactResidualGraph& _graph, const size_t* _distances, size_t _vertex)
+	{
+		const size_t begin{ _graph.firstArc (_vertex) }, end{ _graph.endArc (_vertex) };
+		switch (s_kernel)
+		{
+#ifdef MF_ARC_SCAN_X86
+			case EArcScanKernel::AVX512:
+				return minHeadDistanceAVX512 (_graph.heads (), _graph.residuals (), _distances, begin, end);
+			case EArcScanKernel::AVX2:
+				return minHeadDistanceAVX2 (_graph.heads (), _graph.residuals (), _distances, begin, end);
+#endif
+			default:
+				return minHeadDistanceScalar (_graph.heads (), _graph.residuals (), _distances, begin, end);
+		}
+	}
+
+}
\ No newline at end of file
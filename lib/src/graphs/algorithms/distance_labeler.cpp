@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <stdexcept>
-#include <queue>
 
 
 namespace MaxFlow::Graphs::Algorithms
@@ -60,80 +59,76 @@ namespace MaxFlow::Graphs::Algorithms
 		return m_valid;
 	}
 
-	DistanceLabeler::DistanceLabeler(ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink)
-		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_labels{}
+	DistanceLabeler::DistanceLabeler(const CompactResidualGraph& _graph, size_t _source, size_t _sink)
+		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_distances{}, m_queue{}
 	{
-		ResidualGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
+		if (_source == _sink)
+		{
+			throw std::logic_error{ "source == sink" };
+		}
 	}
 
 	void DistanceLabeler::reset()
 	{
-		m_labels.resize(m_graph.verticesCount());
-		std::fill(m_labels.begin(), m_labels.end(), Label{});
+		m_distances.resize(m_graph.verticesCount());
+		std::fill(m_distances.begin(), m_distances.end(), noDistance);
 	}
 
 	void DistanceLabeler::calculate(EdgeSelector& _edgeSelector)
 	{
 		reset();
-		std::queue<ResidualVertex*> queue{};
-		ResidualGraph transposed;
-		transposed.setMatrix(false);
-		transposed.addVertices(m_graph.verticesCount());
-		for (const ResidualVertex& vertex : m_graph)
+		// Backward breadth first search: the arc from the head back to the scanned vertex is the reverse arc
+		m_queue.clear();
+		m_queue.reserve(m_graph.verticesCount());
+		m_distances[m_sink] = 0;
+		m_queue.push_back(m_sink);
+		for (size_t q{ 0 }; q < m_queue.size(); q++)
 		{
-			ResidualVertex& transposedVertex{ transposed[vertex.index()] };
-			for (const ResidualEdge& edge : vertex)
+			const size_t vertex{ m_queue[q] };
+			const size_t distance{ m_distances[vertex] + 1 };
+			for (size_t arc{ m_graph.firstArc(vertex) }; arc < m_graph.endArc(vertex); arc++)
 			{
-				if (*edge)
+				const size_t head{ m_graph.head(arc) }, reverse{ m_graph.reverse(arc) };
+				if (m_distances[head] == noDistance && m_graph.residual(reverse) && _edgeSelector(m_graph, reverse))
 				{
-					transposed[edge.to().index()].addOutEdge(transposedVertex, *edge);
-				}
-			}
-		}
-		m_labels[m_sink.index()] = { 0 };
-		queue.push(&transposed[m_sink.index()]);
-		while (!queue.empty())
-		{
-			ResidualVertex& vertex{ *queue.front() };
-			queue.pop();
-			for (ResidualEdge& edge : vertex)
-			{
-				if (!m_labels[edge.to().index()].valid() && _edgeSelector(edge))
-				{
-					m_labels[edge.to().index()] = *m_labels[edge.from().index()] + 1;
-					queue.push(&edge.to());
+					m_distances[head] = distance;
+					m_queue.push_back(head);
 				}
 			}
 		}
 	}
 
-	DistanceLabeler::Label DistanceLabeler::operator[](const ResidualVertex& _vertex) const
+	DistanceLabeler::Label DistanceLabeler::operator[](size_t _vertex) const
 	{
-		ResidualGraph::ensureSameGraph(_vertex.graph(), m_graph);
-		return m_labels[_vertex.index()];
+		const size_t distance{ m_distances[_vertex] };
+		return distance == noDistance ? Label{} : Label{ distance };
 	}
 
-	void DistanceLabeler::setLabel(ResidualVertex& _vertex, Label _label)
+	void DistanceLabeler::setLabel(size_t _vertex, Label _label)
 	{
-		ResidualGraph::ensureSameGraph(m_graph, _vertex.graph());
-		m_labels[_vertex.index()] = _label;
+		m_distances[_vertex] = _label.valid() ? *_label : noDistance;
 	}
 
-	void DistanceLabeler::setDistance(ResidualVertex& _vertex, size_t _distance)
+	void DistanceLabeler::setDistance(size_t _vertex, size_t _distance)
 	{
 		setLabel(_vertex, _distance);
 	}
 
-	void DistanceLabeler::resetDistance(ResidualVertex& _vertex)
+	void DistanceLabeler::resetDistance(size_t _vertex)
 	{
 		setLabel(_vertex, {});
 	}
 
-	bool DistanceLabeler::isAdmissible(const ResidualEdge& _edge) const
+	bool DistanceLabeler::isAdmissible(size_t _from, size_t _arc) const
+	{
+		const size_t from{ m_distances[_from] };
+		const size_t to{ m_distances[m_graph.head(_arc)] };
+		return m_graph.residual(_arc) && from != noDistance && to != noDistance && from == to + 1;
+	}
+
+	const size_t* DistanceLabeler::distances() const
 	{
-		const Label from{ (*this)[_edge.from()] };
-		const Label to{ (*this)[_edge.to()] };
-		return *_edge && from.valid() && to.valid() && *from == *to + 1;
+		return m_distances.data();
 	}
 
 }
\ No newline at end of file
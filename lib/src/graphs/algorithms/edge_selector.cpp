@@ -1,5 +1,5 @@
 #include <max-flow\graphs\algorithms\edge_selector.hpp>
-#include <max-flow\graphs\residual.hpp>
+#include <max-flow\graphs\compact_residual.hpp>
 
 
 namespace MaxFlow::Graphs::Algorithms
@@ -7,7 +7,7 @@ namespace MaxFlow::Graphs::Algorithms
 
 	EdgeSelector EdgeSelector::all{};
 
-	bool EdgeSelector::operator() (const ResidualEdge& _edge)
+	bool EdgeSelector::operator() (const CompactResidualGraph& _graph, size_t _arc)
 	{
 		return true;
 	}
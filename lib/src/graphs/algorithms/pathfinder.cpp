@@ -1,40 +1,58 @@
 #include <max-flow\graphs\algorithms\pathfinder.hpp>
 
 #include <algorithm>
-#include <queue>
-#include <stack>
+#include <stdexcept>
 
 namespace MaxFlow::Graphs::Algorithms
 {
 
-	Pathfinder::Pathfinder (ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink)
-		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_predecessors{}
+	Pathfinder::Pathfinder (const CompactResidualGraph& _graph, size_t _source, size_t _sink)
+		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_predecessorArcs{}, m_frontier{}, m_successorArcs{}, m_backwardFrontier{}, m_labeledVertices{}
 	{
-		ResidualGraph::ensureSameGraph (_graph, _source.graph (), _sink.graph ());
+		if (_source == _sink)
+		{
+			throw std::logic_error{ "source == sink" };
+		}
+	}
+
+	const CompactResidualGraph& Pathfinder::graph () const
+	{
+		return m_graph;
 	}
 
 	void Pathfinder::reset ()
 	{
-		m_predecessors.resize (m_graph.verticesCount ());
-		std::fill (m_predecessors.begin (), m_predecessors.end (), nullptr);
+		// Only the labeled vertices are cleared, unless the graph size changed
+		if (m_predecessorArcs.size () != m_graph.verticesCount ())
+		{
+			m_predecessorArcs.assign (m_graph.verticesCount (), CompactResidualGraph::noArc);
+		}
+		else
+		{
+			for (const size_t vertex : m_labeledVertices)
+			{
+				m_predecessorArcs[vertex] = CompactResidualGraph::noArc;
+			}
+		}
+		m_labeledVertices.clear ();
 	}
 
 	void Pathfinder::calculateBreadthFirst (EdgeSelector& _edgeSelector)
 	{
 		reset ();
-		setPredecessor (m_source, m_source);
-		std::queue<ResidualVertex*> queue{};
-		queue.push (&m_source);
-		while (!queue.empty () && !isSinkLabeled ())
-		{
-			ResidualVertex& vertex{ *queue.front () };
-			queue.pop ();
-			for (ResidualEdge& edge : vertex)
+		assignPredecessor (m_source, rootArc);
+		m_frontier.clear ();
+		m_frontier.push_back (m_source);
+		for (size_t q{ 0 }; q < m_frontier.size () && !isSinkLabeled (); q++)
+		{
+			const size_t vertex{ m_frontier[q] };
+			for (size_t arc{ m_graph.firstArc (vertex) }; arc < m_graph.endArc (vertex); arc++)
 			{
-				if (*edge && !isLabeled (edge.to ()) && _edgeSelector (edge))
+				const size_t head{ m_graph.head (arc) };
+				if (m_graph.residual (arc) && !isLabeled (head) && _edgeSelector (m_graph, arc))
 				{
-					setPredecessor (edge.to (), vertex);
-					queue.push (&edge.to ());
+					assignPredecessor (head, arc);
+					m_frontier.push_back (head);
 				}
 			}
 		}
@@ -43,100 +61,280 @@ namespace MaxFlow::Graphs::Algorithms
 	void Pathfinder::calculateDepthFirst(EdgeSelector& _edgeSelector)
 	{
 		reset();
-		setPredecessor(m_source, m_source);
-		std::stack<ResidualVertex*> stack{};
-		stack.push(&m_source);
-		while (!stack.empty() && !isSinkLabeled())
-		{
-			ResidualVertex& vertex{ *stack.top() };
-			stack.pop();
-			for (auto it{ vertex.rbegin() }; it != vertex.rend(); ++it)
+		assignPredecessor (m_source, rootArc);
+		m_frontier.clear();
+		m_frontier.push_back(m_source);
+		while (!m_frontier.empty() && !isSinkLabeled())
+		{
+			const size_t vertex{ m_frontier.back() };
+			m_frontier.pop_back();
+			for (size_t arc{ m_graph.endArc(vertex) }; arc-- > m_graph.firstArc(vertex);)
 			{
-				ResidualEdge& edge{ *it };
-				if (*edge && !isLabeled(edge.to()) && _edgeSelector(edge))
+				const size_t head{ m_graph.head(arc) };
+				if (m_graph.residual(arc) && !isLabeled(head) && _edgeSelector(m_graph, arc))
 				{
-					setPredecessor(edge.to(), vertex);
-					stack.push(&edge.to());
+					assignPredecessor (head, arc);
+					m_frontier.push_back(head);
 				}
 			}
 		}
 	}
 
-	const ResidualVertex& Pathfinder::operator[](const ResidualVertex& _vertex) const
+	void Pathfinder::calculateBreadthFirst (const DeltaResidualView& _view)
 	{
-		return const_cast<Pathfinder&>(*this)[const_cast<ResidualVertex&>(_vertex)];
+		if (&_view.graph () != &m_graph)
+		{
+			throw std::logic_error{ "view of another graph" };
+		}
+		reset ();
+		assignPredecessor (m_source, rootArc);
+		m_frontier.clear ();
+		m_frontier.push_back (m_source);
+		for (size_t q{ 0 }; q < m_frontier.size () && !isSinkLabeled (); q++)
+		{
+			for (const size_t arc : _view.arcs (m_frontier[q]))
+			{
+				const size_t head{ m_graph.head (arc) };
+				if (!isLabeled (head) && _view.isEligible (arc))
+				{
+					assignPredecessor (head, arc);
+					m_frontier.push_back (head);
+				}
+			}
+		}
 	}
 
+	void Pathfinder::calculateDepthFirst (const DeltaResidualView& _view)
+	{
+		if (&_view.graph () != &m_graph)
+		{
+			throw std::logic_error{ "view of another graph" };
+		}
+		reset ();
+		assignPredecessor (m_source, rootArc);
+		m_frontier.clear ();
+		m_frontier.push_back (m_source);
+		while (!m_frontier.empty () && !isSinkLabeled ())
+		{
+			const size_t vertex{ m_frontier.back () };
+			m_frontier.pop_back ();
+			const std::span<const size_t> arcs{ _view.arcs (vertex) };
+			for (auto it{ arcs.rbegin () }; it != arcs.rend (); ++it)
+			{
+				const size_t head{ m_graph.head (*it) };
+				if (!isLabeled (head) && _view.isEligible (*it))
+				{
+					assignPredecessor (head, *it);
+					m_frontier.push_back (head);
+				}
+			}
+		}
+	}
 
-	ResidualVertex& Pathfinder::operator[](ResidualVertex& _vertex)
+	template<typename TForwardArcs, typename TBackwardArcs>
+	void Pathfinder::calculateBidirectional (TForwardArcs _forwardArcs, TBackwardArcs _backwardArcs)
 	{
-		ResidualGraph::ensureSameGraph (_vertex.graph (), m_graph);
-		return *m_predecessors[_vertex.index ()];
+		reset ();
+		if (m_successorArcs.size () != m_graph.verticesCount ())
+		{
+			m_successorArcs.assign (m_graph.verticesCount (), CompactResidualGraph::noArc);
+		}
+		else
+		{
+			// Every vertex with a successor arc is in the backward frontier of the last search
+			for (const size_t vertex : m_backwardFrontier)
+			{
+				m_successorArcs[vertex] = CompactResidualGraph::noArc;
+			}
+		}
+		assignPredecessor (m_source, rootArc);
+		m_successorArcs[m_sink] = rootArc;
+		m_frontier.clear ();
+		m_frontier.push_back (m_source);
+		m_backwardFrontier.clear ();
+		m_backwardFrontier.push_back (m_sink);
+		size_t meeting{ CompactResidualGraph::noArc };
+		size_t forwardLevel{ 0 }, backwardLevel{ 0 };
+		while (meeting == CompactResidualGraph::noArc && forwardLevel < m_frontier.size () && backwardLevel < m_backwardFrontier.size ())
+		{
+			if (m_frontier.size () - forwardLevel <= m_backwardFrontier.size () - backwardLevel)
+			{
+				const size_t levelEnd{ m_frontier.size () };
+				for (size_t q{ forwardLevel }; q < levelEnd && meeting == CompactResidualGraph::noArc; q++)
+				{
+					_forwardArcs (m_frontier[q], [&] (size_t _arc) {
+						const size_t head{ m_graph.head (_arc) };
+						if (meeting == CompactResidualGraph::noArc && !isLabeled (head))
+						{
+							assignPredecessor (head, _arc);
+							m_frontier.push_back (head);
+							if (m_successorArcs[head] != CompactResidualGraph::noArc)
+							{
+								meeting = head;
+							}
+						}
+					});
+				}
+				forwardLevel = levelEnd;
+			}
+			else
+			{
+				const size_t levelEnd{ m_backwardFrontier.size () };
+				for (size_t q{ backwardLevel }; q < levelEnd && meeting == CompactResidualGraph::noArc; q++)
+				{
+					_backwardArcs (m_backwardFrontier[q], [&] (size_t _arc) {
+						const size_t tail{ m_graph.tail (_arc) };
+						if (meeting == CompactResidualGraph::noArc && m_successorArcs[tail] == CompactResidualGraph::noArc)
+						{
+							m_successorArcs[tail] = _arc;
+							m_backwardFrontier.push_back (tail);
+							if (isLabeled (tail))
+							{
+								meeting = tail;
+							}
+						}
+					});
+				}
+				backwardLevel = levelEnd;
+			}
+		}
+		if (meeting != CompactResidualGraph::noArc)
+		{
+			// Join the backward half of the path to the predecessor tree
+			for (size_t vertex{ meeting }; vertex != m_sink;)
+			{
+				const size_t arc{ m_successorArcs[vertex] };
+				vertex = m_graph.head (arc);
+				assignPredecessor (vertex, arc);
+			}
+		}
 	}
 
-	void Pathfinder::resetPredecessor (ResidualVertex& _vertex)
+	void Pathfinder::calculateBidirectional (EdgeSelector& _edgeSelector)
 	{
-		ResidualGraph::ensureSameGraph (m_graph, _vertex.graph ());
-		m_predecessors.resize (m_graph.verticesCount ());
-		m_predecessors[_vertex.index ()] = nullptr;
+		calculateBidirectional (
+			[&] (size_t _vertex, auto&& _visit) {
+				for (size_t arc{ m_graph.firstArc (_vertex) }; arc < m_graph.endArc (_vertex); arc++)
+				{
+					if (m_graph.residual (arc) && _edgeSelector (m_graph, arc))
+					{
+						_visit (arc);
+					}
+				}
+			},
+			[&] (size_t _vertex, auto&& _visit) {
+				for (size_t arc{ m_graph.firstArc (_vertex) }; arc < m_graph.endArc (_vertex); arc++)
+				{
+					const size_t reverse{ m_graph.reverse (arc) };
+					if (m_graph.residual (reverse) && _edgeSelector (m_graph, reverse))
+					{
+						_visit (reverse);
+					}
+				}
+			});
+	}
+
+	void Pathfinder::calculateBidirectional (const DeltaResidualView& _view)
+	{
+		if (&_view.graph () != &m_graph)
+		{
+			throw std::logic_error{ "view of another graph" };
+		}
+		calculateBidirectional (
+			[&] (size_t _vertex, auto&& _visit) {
+				for (const size_t arc : _view.arcs (_vertex))
+				{
+					if (_view.isEligible (arc))
+					{
+						_visit (arc);
+					}
+				}
+			},
+			[&] (size_t _vertex, auto&& _visit) {
+				for (size_t arc{ m_graph.firstArc (_vertex) }; arc < m_graph.endArc (_vertex); arc++)
+				{
+					const size_t reverse{ m_graph.reverse (arc) };
+					if (_view.isEligible (reverse))
+					{
+						_visit (reverse);
+					}
+				}
+			});
 	}
 
-	void Pathfinder::setPredecessor (ResidualVertex& _vertex, ResidualVertex& _predecessor)
+	size_t Pathfinder::predecessorArc (size_t _vertex) const
 	{
-		ResidualGraph::ensureSameGraph (m_graph, _vertex.graph (), _predecessor.graph ());
-		m_predecessors.resize (m_graph.verticesCount ());
-		m_predecessors[_vertex.index ()] = &_predecessor;
+		return m_predecessorArcs[_vertex];
 	}
 
-	void Pathfinder::setPredecessor (ResidualEdge& _edge)
+	size_t Pathfinder::operator[](size_t _vertex) const
 	{
-		setPredecessor (_edge.to (), _edge.from ());
+		const size_t arc{ m_predecessorArcs[_vertex] };
+		if (arc == CompactResidualGraph::noArc)
+		{
+			throw std::logic_error{ "not labeled" };
+		}
+		return arc == rootArc ? _vertex : m_graph.tail (arc);
 	}
 
-	bool Pathfinder::isLabeled (const ResidualVertex& _vertex) const
+	void Pathfinder::resetPredecessor (size_t _vertex)
 	{
-		ResidualGraph::ensureSameGraph (_vertex.graph (), m_graph);
-		return m_predecessors[_vertex.index ()];
+		if (m_predecessorArcs.size () != m_graph.verticesCount ())
+		{
+			reset ();
+		}
+		if (_vertex == m_source)
+		{
+			assignPredecessor (_vertex, rootArc);
+		}
+		else
+		{
+			m_predecessorArcs[_vertex] = CompactResidualGraph::noArc;
+		}
 	}
 
-	bool Pathfinder::isSinkLabeled () const
+	void Pathfinder::setPredecessor (size_t _arc)
 	{
-		return isLabeled (m_sink);
+		if (m_predecessorArcs.size () != m_graph.verticesCount ())
+		{
+			reset ();
+		}
+		assignPredecessor (m_graph.head (_arc), _arc);
 	}
 
-	bool Pathfinder::isSourceLabeled () const
+	bool Pathfinder::isLabeled (size_t _vertex) const
 	{
-		return isLabeled (m_source);
+		return m_predecessorArcs[_vertex] != CompactResidualGraph::noArc;
 	}
 
-	Pathfinder::IteratorC Pathfinder::begin () const
+	bool Pathfinder::isSinkLabeled () const
 	{
-		return IteratorC{ *this, m_sink };
+		return isLabeled (m_sink);
 	}
 
-	Pathfinder::IteratorC Pathfinder::cbegin () const
+	bool Pathfinder::isSourceLabeled () const
 	{
-		return IteratorC{ *this, m_sink };
+		return isLabeled (m_source);
 	}
 
-	Pathfinder::IteratorM Pathfinder::begin ()
+	Pathfinder::Iterator Pathfinder::begin () const
 	{
-		return IteratorM{ *this, m_sink };
+		return Iterator{ *this, m_sink };
 	}
 
-	Pathfinder::IteratorC Pathfinder::end () const
+	Pathfinder::Iterator Pathfinder::cbegin () const
 	{
-		return IteratorC{ *this, m_source };
+		return Iterator{ *this, m_sink };
 	}
 
-	Pathfinder::IteratorC Pathfinder::cend () const
+	Pathfinder::Iterator Pathfinder::end () const
 	{
-		return IteratorC{ *this, m_source };
+		return Iterator{ *this, m_source };
 	}
 
-	Pathfinder::IteratorM Pathfinder::end ()
+	Pathfinder::Iterator Pathfinder::cend () const
 	{
-		return IteratorM{ *this, m_source };
+		return Iterator{ *this, m_source };
 	}
 
 }
\ No newline at end of file
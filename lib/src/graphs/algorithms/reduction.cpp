@@ -0,0 +1,290 @@
+#include <max-flow/graphs/algorithms/reduction.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace MaxFlow::Graphs::Algorithms
+{
+
+	namespace
+	{
+
+		constexpr size_t noIndex{ std::numeric_limits<size_t>::max () };
+
+		// Vertices reachable from _start, following the arcs forward or backward
+		template<typename TArc>
+		std::vector<bool> reachable (size_t _verticesCount, size_t _start, const std::vector<TArc>& _arcs, bool _forward)
+		{
+			std::vector<size_t> firsts (_verticesCount + 1, 0);
+			for (const TArc& arc : _arcs)
+			{
+				firsts[(_forward ? arc.from : arc.to) + 1]++;
+			}
+			for (size_t v{ 0 }; v < _verticesCount; v++)
+			{
+				firsts[v + 1] += firsts[v];
+			}
+			std::vector<size_t> heads (_arcs.size ());
+			{
+				std::vector<size_t> next{ firsts.begin (), firsts.end () - 1 };
+				for (const TArc& arc : _arcs)
+				{
+					heads[next[_forward ? arc.from : arc.to]++] = _forward ? arc.to : arc.from;
+				}
+			}
+			std::vector<bool> visited (_verticesCount, false);
+			std::vector<size_t> queue{};
+			queue.reserve (_verticesCount);
+			queue.push_back (_start);
+			visited[_start] = true;
+			for (size_t q{ 0 }; q < queue.size (); q++)
+			{
+				const size_t vertex{ queue[q] };
+				for (size_t a{ firsts[vertex] }; a < firsts[vertex + 1]; a++)
+				{
+					if (!visited[heads[a]])
+					{
+						visited[heads[a]] = true;
+						queue.push_back (heads[a]);
+					}
+				}
+			}
+			return visited;
+		}
+
+	}
+
+	size_t Reduction::addNode (ENode _kind, size_t _first, size_t _second)
+	{
+		flow_t capacity{};
+		switch (_kind)
+		{
+		case ENode::Series:
+			capacity = std::min (m_nodes[_first].capacity, m_nodes[_second].capacity);
+			break;
+		case ENode::Parallel:
+			capacity = m_nodes[_first].capacity + m_nodes[_second].capacity;
+			break;
+		default:
+			throw std::logic_error{ "not a combined node" };
+		}
+		m_nodes.push_back ({ .kind{ _kind }, .capacity{ capacity }, .first{ _first }, .second{ _second } });
+		return m_nodes.size () - 1;
+	}
+
+	void Reduction::mergeParallelArcs (std::vector<Arc>& _arcs)
+	{
+		std::sort (_arcs.begin (), _arcs.end (), [] (const Arc& _a, const Arc& _b) {
+			return _a.from != _b.from ? _a.from < _b.from : _a.to < _b.to;
+		});
+		size_t count{ 0 };
+		for (const Arc& arc : _arcs)
+		{
+			if (count && _arcs[count - 1].from == arc.from && _arcs[count - 1].to == arc.to)
+			{
+				_arcs[count - 1].node = addNode (ENode::Parallel, _arcs[count - 1].node, arc.node);
+			}
+			else
+			{
+				_arcs[count++] = arc;
+			}
+		}
+		_arcs.resize (count);
+	}
+
+	void Reduction::contractSeriesArcs (std::vector<Arc>& _arcs, size_t _verticesCount, size_t _source, size_t _sink)
+	{
+		// A vertex with a single in arc and a single out arc finds them as the xor of its in and out arc indices
+		std::vector<size_t> inDegrees (_verticesCount, 0), outDegrees (_verticesCount, 0), inArcs (_verticesCount, 0), outArcs (_verticesCount, 0);
+		std::vector<bool> removed (_arcs.size (), false);
+		for (size_t a{ 0 }; a < _arcs.size (); a++)
+		{
+			outDegrees[_arcs[a].from]++;
+			outArcs[_arcs[a].from] ^= a;
+			inDegrees[_arcs[a].to]++;
+			inArcs[_arcs[a].to] ^= a;
+		}
+		const auto isSeries{ [&] (size_t _vertex) {
+			return _vertex != _source && _vertex != _sink && inDegrees[_vertex] == 1 && outDegrees[_vertex] == 1;
+		} };
+		std::vector<size_t> queue{};
+		for (size_t v{ 0 }; v < _verticesCount; v++)
+		{
+			if (isSeries (v))
+			{
+				queue.push_back (v);
+			}
+		}
+		while (!queue.empty ())
+		{
+			const size_t vertex{ queue.back () };
+			queue.pop_back ();
+			if (!isSeries (vertex))
+			{
+				continue;
+			}
+			const size_t in{ inArcs[vertex] }, out{ outArcs[vertex] };
+			const size_t from{ _arcs[in].from }, to{ _arcs[out].to };
+			removed[in] = removed[out] = true;
+			inDegrees[vertex] = outDegrees[vertex] = inArcs[vertex] = outArcs[vertex] = 0;
+			if (from == to)
+			{
+				// A dead end loop can only carry a circulation, so it is dropped and its edges get no flow
+				outDegrees[from]--;
+				outArcs[from] ^= in;
+				inDegrees[from]--;
+				inArcs[from] ^= out;
+				if (isSeries (from))
+				{
+					queue.push_back (from);
+				}
+			}
+			else
+			{
+				const size_t arc{ _arcs.size () };
+				_arcs.push_back ({ .from{ from }, .to{ to }, .node{ addNode (ENode::Series, _arcs[in].node, _arcs[out].node) } });
+				removed.push_back (false);
+				outArcs[from] ^= in ^ arc;
+				inArcs[to] ^= out ^ arc;
+			}
+		}
+		size_t count{ 0 };
+		for (size_t a{ 0 }; a < _arcs.size (); a++)
+		{
+			if (!removed[a])
+			{
+				_arcs[count++] = _arcs[a];
+			}
+		}
+		_arcs.resize (count);
+	}
+
+	Reduction::Reduction (size_t _verticesCount, size_t _source, size_t _sink, std::span<const FlowEdgeList::Edge> _edges, bool _combineArcs)
+		: m_edgesCount{ _edges.size () }
+	{
+		if (_source >= _verticesCount || _sink >= _verticesCount)
+		{
+			throw std::out_of_range{ "terminal out of range" };
+		}
+		if (_source == _sink)
+		{
+			throw std::invalid_argument{ "source == sink" };
+		}
+		std::vector<Arc> arcs{};
+		arcs.reserve (_edges.size ());
+		m_nodes.reserve (_edges.size ());
+		for (size_t e{ 0 }; e < _edges.size (); e++)
+		{
+			const FlowEdgeList::Edge& edge{ _edges[e] };
+			if (edge.from >= _verticesCount || edge.to >= _verticesCount)
+			{
+				throw std::out_of_range{ "edge vertex out of range" };
+			}
+			if (edge.capacity < 0)
+			{
+				throw std::out_of_range{ "capacity < 0" };
+			}
+			if (edge.capacity && edge.from != edge.to && edge.to != _source && edge.from != _sink)
+			{
+				m_nodes.push_back ({ .kind{ ENode::Edge }, .capacity{ edge.capacity }, .first{ e }, .second{ noIndex } });
+				arcs.push_back ({ .from{ edge.from }, .to{ edge.to }, .node{ m_nodes.size () - 1 } });
+			}
+		}
+		{
+			const std::vector<bool> fromSource{ reachable (_verticesCount, _source, arcs, true) };
+			const std::vector<bool> toSink{ reachable (_verticesCount, _sink, arcs, false) };
+			std::erase_if (arcs, [&] (const Arc& _arc) {
+				return !fromSource[_arc.from] || !toSink[_arc.from] || !fromSource[_arc.to] || !toSink[_arc.to];
+			});
+		}
+		if (_combineArcs)
+		{
+			mergeParallelArcs (arcs);
+			contractSeriesArcs (arcs, _verticesCount, _source, _sink);
+			// Contractions may have created new parallel arcs
+			mergeParallelArcs (arcs);
+		}
+		std::vector<size_t> indices (_verticesCount, noIndex);
+		size_t verticesCount{ 0 };
+		indices[_source] = verticesCount++;
+		indices[_sink] = verticesCount++;
+		for (const Arc& arc : arcs)
+		{
+			for (const size_t vertex : { arc.from, arc.to })
+			{
+				if (indices[vertex] == noIndex)
+				{
+					indices[vertex] = verticesCount++;
+				}
+			}
+		}
+		m_source = indices[_source];
+		m_sink = indices[_sink];
+		m_reduced = FlowEdgeList{ verticesCount };
+		m_reduced.reserve (arcs.size ());
+		m_reducedNodes.reserve (arcs.size ());
+		for (const Arc& arc : arcs)
+		{
+			m_reduced.addEdge (indices[arc.from], indices[arc.to], m_nodes[arc.node].capacity);
+			m_reducedNodes.push_back (arc.node);
+		}
+	}
+
+	const FlowEdgeList& Reduction::reduced () const
+	{
+		return m_reduced;
+	}
+
+	FlowEdgeList& Reduction::reduced ()
+	{
+		return m_reduced;
+	}
+
+	size_t Reduction::source () const
+	{
+		return m_source;
+	}
+
+	size_t Reduction::sink () const
+	{
+		return m_sink;
+	}
+
+	std::vector<flow_t> Reduction::originalFlows () const
+	{
+		std::vector<flow_t> flows (m_edgesCount, 0);
+		std::vector<std::pair<size_t, flow_t>> stack{};
+		for (size_t e{ 0 }; e < m_reducedNodes.size (); e++)
+		{
+			stack.push_back ({ m_reducedNodes[e], m_reduced[e].flow });
+			while (!stack.empty ())
+			{
+				const auto [index, flow] { stack.back () };
+				stack.pop_back ();
+				const Node& node{ m_nodes[index] };
+				switch (node.kind)
+				{
+				case ENode::Edge:
+					flows[node.first] = flow;
+					break;
+				case ENode::Series:
+					stack.push_back ({ node.first, flow });
+					stack.push_back ({ node.second, flow });
+					break;
+				case ENode::Parallel:
+				{
+					// Fill the first branch, any excess goes to the second one
+					const flow_t firstFlow{ std::min (flow, m_nodes[node.first].capacity) };
+					stack.push_back ({ node.first, firstFlow });
+					stack.push_back ({ node.second, flow - firstFlow });
+					break;
+				}
+				}
+			}
+		}
+		return flows;
+	}
+
+}
\ No newline at end of file
@@ -100,31 +100,29 @@ namespace MaxFlow::Graphs::Algorithms
 		}
 	}
 
-	flow_t minCapacity (Pathfinder::IteratorC _start, Pathfinder::IteratorC _end)
+	flow_t minCapacity (const CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end)
 	{
 		flow_t minR{ std::numeric_limits<Graphs::flow_t>::max () };
-		for (Pathfinder::IteratorC it{ _start }; it != _end; ++it)
+		for (Pathfinder::Iterator it{ _start }; it != _end; ++it)
 		{
-			const ResidualEdge& edge{ *it };
-			if (*edge < minR)
+			if (_graph.residual (*it) < minR)
 			{
-				minR = *edge;
+				minR = _graph.residual (*it);
 			}
 		}
 		return minR;
 	}
 
-	void augmentMax (const Pathfinder::IteratorM _start, const Pathfinder::IteratorM _end, bool _removeZeroEdge)
+	void augmentMax (CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end)
 	{
-		augment (_start, _end, minCapacity (_start, _end), _removeZeroEdge);
+		augment (_graph, _start, _end, minCapacity (_graph, _start, _end));
 	}
 
-	void augment (Pathfinder::IteratorM _start, Pathfinder::IteratorM _end, flow_t _amount, bool _removeZeroEdge)
+	void augment (CompactResidualGraph& _graph, Pathfinder::Iterator _start, Pathfinder::Iterator _end, flow_t _amount)
 	{
-		for (Pathfinder::IteratorM it{ _start }; it != _end; ++it)
+		for (Pathfinder::Iterator it{ _start }; it != _end; ++it)
 		{
-			ResidualEdge& edge{ *it };
-			augment (edge, _amount, _removeZeroEdge);
+			_graph.augment (*it, _amount);
 		}
 	}
 
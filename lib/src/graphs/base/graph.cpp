@@ -68,6 +68,57 @@ namespace MaxFlow::Graphs::Base
 		destroyVertex ((*this)[_vertex]);
 	}
 
+	void Graph::destroyVertices (const std::vector<bool>& _destroyed)
+	{
+		if (_destroyed.size () != verticesCount ())
+		{
+			throw std::invalid_argument{ "destroyed.size() != verticesCount" };
+		}
+		std::vector<size_t> newIndices (verticesCount (), noIndex);
+		size_t count{ 0 };
+		for (size_t i{ 0 }; i < verticesCount (); i++)
+		{
+			if (!_destroyed[i])
+			{
+				newIndices[i] = count++;
+			}
+		}
+		if (count == verticesCount ())
+		{
+			return;
+		}
+		for (size_t i{ 0 }; i < verticesCount (); i++)
+		{
+			Vertex& vertex{ *m_vertices[i] };
+			if (_destroyed[i])
+			{
+				vertex.setMatrix (false);
+				vertex.destroyAllOutEdges ();
+			}
+			else
+			{
+				vertex.destroyOutEdgesTo (_destroyed);
+			}
+		}
+		for (size_t i{ 0 }; i < verticesCount (); i++)
+		{
+			if (_destroyed[i])
+			{
+				delete m_vertices[i];
+			}
+			else
+			{
+				m_vertices[newIndices[i]] = m_vertices[i];
+				m_vertices[newIndices[i]]->setIndex (newIndices[i]);
+			}
+		}
+		m_vertices.resize (count);
+		for (Vertex& vertex : *this)
+		{
+			vertex.verticesCompacted (newIndices, count);
+		}
+	}
+
 	void Graph::destroyAllVertices ()
 	{
 		for (Vertex& vertex : *this)
@@ -96,6 +147,11 @@ namespace MaxFlow::Graphs::Base
 		m_edgesCount++;
 	}
 
+	void Graph::edgesAdded (size_t _count)
+	{
+		m_edgesCount += _count;
+	}
+
 	void Graph::edgeRemoved ()
 	{
 		m_edgesCount--;
@@ -61,6 +61,30 @@ namespace MaxFlow::Graphs::Base
 		graph().edgeAdded();
 	}
 
+	void Vertex::addNewValidatedOutEdges(std::span<Edge* const> _edges)
+	{
+		for (Edge* pEdge : _edges)
+		{
+			pEdge->m_pPrevious = m_pLastOutEdge;
+			pEdge->m_pNext = nullptr;
+			if (m_pLastOutEdge)
+			{
+				m_pLastOutEdge->m_pNext = pEdge;
+			}
+			else
+			{
+				m_pFirstOutEdge = pEdge;
+			}
+			m_pLastOutEdge = pEdge;
+			if (hasMatrix())
+			{
+				(*m_pOutVertexEdges)[pEdge->to().index()] = pEdge;
+			}
+		}
+		m_outEdgesCount += _edges.size();
+		graph().edgesAdded(_edges.size());
+	}
+
 	void Vertex::ensureValidNewOutEdge(const Vertex& _to) const
 	{
 		Graph::ensureSameGraph(_to.graph(), graph());
@@ -132,6 +156,36 @@ namespace MaxFlow::Graphs::Base
 		}
 	}
 
+	void Vertex::verticesCompacted(const std::vector<size_t>& _newIndices, size_t _count)
+	{
+		if (hasMatrix())
+		{
+			std::vector<Edge*>& matrix{ *m_pOutVertexEdges };
+			for (size_t i{ 0 }; i < _newIndices.size(); i++)
+			{
+				if (_newIndices[i] != Graph::noIndex)
+				{
+					matrix[_newIndices[i]] = matrix[i];
+				}
+			}
+			matrix.resize(_count);
+		}
+	}
+
+	void Vertex::destroyOutEdgesTo(const std::vector<bool>& _destroyed)
+	{
+		Edge* pEdge{ m_pFirstOutEdge };
+		while (pEdge)
+		{
+			Edge* pNext{ pEdge->next() };
+			if (_destroyed[pEdge->to().index()])
+			{
+				destroyEdge(*pEdge);
+			}
+			pEdge = pNext;
+		}
+	}
+
 	void Vertex::vertexSwapped(size_t _a, size_t _b)
 	{
 		graph().ensureValidVertexIndex(_a);
@@ -0,0 +1,112 @@
+#include <max-flow/graphs/compact_residual.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace MaxFlow::Graphs
+{
+
+	CompactResidualGraph::CompactResidualGraph (const ResidualGraph& _graph)
+	{
+		assign (_graph);
+	}
+
+	void CompactResidualGraph::assign (const ResidualGraph& _graph)
+	{
+		const size_t verticesCount{ _graph.verticesCount () };
+		// Count arcs, including the missing reverse arcs
+		m_firstArcs.assign (verticesCount + 1, 0);
+		for (const ResidualVertex& vertex : _graph)
+		{
+			for (const ResidualEdge& edge : vertex)
+			{
+				m_firstArcs[vertex.index () + 1]++;
+				if (!edge.to ().outEdgeIfExists (vertex))
+				{
+					m_firstArcs[edge.to ().index () + 1]++;
+				}
+			}
+		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			m_firstArcs[v + 1] += m_firstArcs[v];
+		}
+		const size_t arcsCount{ m_firstArcs[verticesCount] };
+		// Fill arcs
+		std::vector<std::pair<size_t, flow_t>>& arcs{ m_sortBuffer };
+		std::vector<size_t>& nextArcs{ m_nextArcs };
+		arcs.resize (arcsCount);
+		nextArcs.assign (m_firstArcs.begin (), m_firstArcs.end () - 1);
+		for (const ResidualVertex& vertex : _graph)
+		{
+			for (const ResidualEdge& edge : vertex)
+			{
+				arcs[nextArcs[vertex.index ()]++] = { edge.to ().index (), *edge };
+				if (!edge.to ().outEdgeIfExists (vertex))
+				{
+					arcs[nextArcs[edge.to ().index ()]++] = { vertex.index (), 0 };
+				}
+			}
+		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			std::sort (arcs.begin () + m_firstArcs[v], arcs.begin () + m_firstArcs[v + 1], [] (const auto& _a, const auto& _b) { return _a.first < _b.first; });
+		}
+		m_heads.resize (arcsCount);
+		m_residuals.resize (arcsCount);
+		for (size_t a{ 0 }; a < arcsCount; a++)
+		{
+			m_heads[a] = arcs[a].first;
+			m_residuals[a] = arcs[a].second;
+		}
+		// Pair reverse arcs
+		m_reverses.resize (arcsCount);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			for (size_t a{ m_firstArcs[v] }; a < m_firstArcs[v + 1]; a++)
+			{
+				m_reverses[a] = findArc (m_heads[a], v);
+			}
+		}
+	}
+
+	void CompactResidualGraph::writeBack (ResidualGraph& _graph, bool _removeZeroEdges) const
+	{
+		_graph.setMatrix (true);
+		for (size_t v{ 0 }; v < verticesCount (); v++)
+		{
+			ResidualVertex& vertex{ _graph[v] };
+			for (size_t a{ m_firstArcs[v] }; a < m_firstArcs[v + 1]; a++)
+			{
+				ResidualEdge* pEdge{ vertex.outEdgeIfExists (m_heads[a]) };
+				if (m_residuals[a])
+				{
+					if (!pEdge)
+					{
+						pEdge = &vertex.addOutEdge (m_heads[a]);
+					}
+					**pEdge = m_residuals[a];
+				}
+				else if (pEdge)
+				{
+					if (_removeZeroEdges)
+					{
+						pEdge->destroy ();
+					}
+					else
+					{
+						**pEdge = 0;
+					}
+				}
+			}
+		}
+	}
+
+	size_t CompactResidualGraph::findArc (size_t _from, size_t _to) const
+	{
+		const auto begin{ m_heads.begin () + m_firstArcs[_from] }, end{ m_heads.begin () + m_firstArcs[_from + 1] };
+		const auto it{ std::lower_bound (begin, end, _to) };
+		return it != end && *it == _to ? static_cast<size_t>(it - m_heads.begin ()) : noArc;
+	}
+
+}
\ No newline at end of file
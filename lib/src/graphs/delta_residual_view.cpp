@@ -0,0 +1,97 @@
+#include <max-flow/graphs/delta_residual_view.hpp>
+
+#include <bit>
+#include <limits>
+
+namespace MaxFlow::Graphs
+{
+
+	namespace
+	{
+
+		constexpr size_t bucketsCount{ std::numeric_limits<flow_t>::digits };
+
+		// Buckets are ordered from the largest residual to the smallest
+		size_t bucket (flow_t _residual)
+		{
+			return bucketsCount - static_cast<size_t>(std::bit_width (_residual));
+		}
+
+		flow_t bucketFloor (size_t _bucket)
+		{
+			return flow_t{ 1 } << (bucketsCount - 1 - _bucket);
+		}
+
+	}
+
+	DeltaResidualView::DeltaResidualView (CompactResidualGraph& _graph) : m_graph{ _graph }
+	{}
+
+	void DeltaResidualView::reset ()
+	{
+		const size_t arcsCount{ m_graph.arcsCount () }, verticesCount{ m_graph.verticesCount () };
+		m_firstBucketArcs.assign (bucketsCount + 1, 0);
+		for (size_t a{ 0 }; a < arcsCount; a++)
+		{
+			if (m_graph.residual (a))
+			{
+				m_firstBucketArcs[bucket (m_graph.residual (a)) + 1]++;
+			}
+		}
+		for (size_t b{ 0 }; b < bucketsCount; b++)
+		{
+			m_firstBucketArcs[b + 1] += m_firstBucketArcs[b];
+		}
+		m_bucketArcs.resize (m_firstBucketArcs[bucketsCount]);
+		std::vector<size_t>& nextBucketArcs{ m_nextBucketArcs };
+		nextBucketArcs.assign (m_firstBucketArcs.begin (), m_firstBucketArcs.end () - 1);
+		for (size_t a{ 0 }; a < arcsCount; a++)
+		{
+			if (m_graph.residual (a))
+			{
+				m_bucketArcs[nextBucketArcs[bucket (m_graph.residual (a))]++] = a;
+			}
+		}
+		m_nextBucket = 0;
+		m_activeArcs.resize (arcsCount);
+		m_endActiveArcs.resize (verticesCount);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			m_endActiveArcs[v] = m_graph.firstArc (v);
+		}
+		m_isActive.assign (arcsCount, false);
+		m_activatedArcs.clear ();
+		m_delta = std::numeric_limits<flow_t>::max ();
+	}
+
+	void DeltaResidualView::setDelta (flow_t _delta)
+	{
+		m_delta = _delta;
+		m_activatedArcs.clear ();
+		for (; m_nextBucket < bucketsCount && bucketFloor (m_nextBucket) >= _delta; m_nextBucket++)
+		{
+			for (size_t i{ m_firstBucketArcs[m_nextBucket] }; i < m_firstBucketArcs[m_nextBucket + 1]; i++)
+			{
+				const size_t arc{ m_bucketArcs[i] };
+				if (!m_isActive[arc])
+				{
+					activate (arc);
+					m_activatedArcs.push_back (arc);
+				}
+			}
+		}
+	}
+
+	flow_t DeltaResidualView::maxDelta () const
+	{
+		for (size_t b{ 0 }; b < bucketsCount; b++)
+		{
+			if (m_firstBucketArcs[b + 1] > m_firstBucketArcs[b])
+			{
+				return bucketFloor (b);
+			}
+		}
+		return 0;
+	}
+
+}
\ No newline at end of file
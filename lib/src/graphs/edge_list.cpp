@@ -0,0 +1,208 @@
+#include <max-flow/graphs/edge_list.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace MaxFlow::Graphs
+{
+
+	FlowEdgeList::FlowEdgeList (size_t _verticesCount) : m_verticesCount{ _verticesCount }
+	{}
+
+	void FlowEdgeList::invalidateArcs ()
+	{
+		m_firstArcs.clear ();
+		m_heads.clear ();
+		m_arcCapacities.clear ();
+		m_edgeArcs.clear ();
+	}
+
+	void FlowEdgeList::ensureArcs () const
+	{
+		if (m_firstArcs.empty ())
+		{
+			throw std::logic_error{ "residual graph not created" };
+		}
+	}
+
+	size_t FlowEdgeList::verticesCount () const
+	{
+		return m_verticesCount;
+	}
+
+	size_t FlowEdgeList::edgesCount () const
+	{
+		return m_edges.size ();
+	}
+
+	const std::vector<FlowEdgeList::Edge>& FlowEdgeList::edges () const
+	{
+		return m_edges;
+	}
+
+	const FlowEdgeList::Edge& FlowEdgeList::operator[] (size_t _edge) const
+	{
+		return m_edges[_edge];
+	}
+
+	void FlowEdgeList::addVertices (size_t _count)
+	{
+		invalidateArcs ();
+		m_verticesCount += _count;
+	}
+
+	void FlowEdgeList::reserve (size_t _edgesCount)
+	{
+		m_edges.reserve (_edgesCount);
+	}
+
+	void FlowEdgeList::addEdge (size_t _from, size_t _to, flow_t _capacity, flow_t _flow)
+	{
+		if (_from >= m_verticesCount || _to >= m_verticesCount)
+		{
+			throw std::out_of_range{ "index >= verticesCount" };
+		}
+		if (_from == _to)
+		{
+			throw std::logic_error{ "self loop" };
+		}
+		if (_flow > _capacity)
+		{
+			throw std::out_of_range{ "flow > capacity" };
+		}
+		invalidateArcs ();
+		m_edges.push_back ({ .from{_from}, .to{_to}, .capacity{_capacity}, .flow{_flow} });
+	}
+
+	ResidualGraph FlowEdgeList::createResidualGraph ()
+	{
+		// Half edge 2e goes along edge e and half edge 2e+1 against it
+		// Two counting sorts, by head and then stably by tail, order them like the arcs, so equal pairs become adjacent and share an arc
+		const size_t halfEdgesCount{ m_edges.size () * 2 };
+		std::vector<size_t> tails (halfEdgesCount), heads (halfEdgesCount);
+		for (size_t e{ 0 }; e < m_edges.size (); e++)
+		{
+			tails[2 * e] = heads[2 * e + 1] = m_edges[e].from;
+			heads[2 * e] = tails[2 * e + 1] = m_edges[e].to;
+		}
+		std::vector<size_t> byHead (halfEdgesCount), byTail (halfEdgesCount), cursors (m_verticesCount + 1);
+		const auto countingSort{ [&] (const std::vector<size_t>& _keys, const std::vector<size_t>* _pInput, std::vector<size_t>& _output) {
+			std::fill (cursors.begin (), cursors.end (), 0);
+			for (const size_t key : _keys)
+			{
+				cursors[key + 1]++;
+			}
+			for (size_t v{ 0 }; v < m_verticesCount; v++)
+			{
+				cursors[v + 1] += cursors[v];
+			}
+			for (size_t i{ 0 }; i < halfEdgesCount; i++)
+			{
+				const size_t h{ _pInput ? (*_pInput)[i] : i };
+				_output[cursors[_keys[h]]++] = h;
+			}
+		} };
+		countingSort (heads, nullptr, byHead);
+		countingSort (tails, &byHead, byTail);
+		invalidateArcs ();
+		m_firstArcs.assign (m_verticesCount + 1, 0);
+		m_edgeArcs.resize (m_edges.size ());
+		std::vector<size_t> reverseArcs (m_edges.size ());
+		for (size_t i{ 0 }; i < halfEdgesCount; i++)
+		{
+			const size_t halfEdge{ byTail[i] };
+			if (!i || tails[byTail[i - 1]] != tails[halfEdge] || heads[byTail[i - 1]] != heads[halfEdge])
+			{
+				m_heads.push_back (heads[halfEdge]);
+				m_firstArcs[tails[halfEdge] + 1]++;
+			}
+			(halfEdge % 2 ? reverseArcs : m_edgeArcs)[halfEdge / 2] = m_heads.size () - 1;
+		}
+		for (size_t v{ 0 }; v < m_verticesCount; v++)
+		{
+			m_firstArcs[v + 1] += m_firstArcs[v];
+		}
+		m_arcCapacities.assign (m_heads.size (), 0);
+		std::vector<flow_t> residuals (m_heads.size (), 0);
+		for (size_t e{ 0 }; e < m_edges.size (); e++)
+		{
+			m_arcCapacities[m_edgeArcs[e]] += m_edges[e].capacity;
+			residuals[m_edgeArcs[e]] += m_edges[e].capacity - m_edges[e].flow;
+			residuals[reverseArcs[e]] += m_edges[e].flow;
+		}
+		ResidualGraph graph;
+		graph.setMatrix (true);
+		graph.addVertices (m_verticesCount);
+		ResidualGraphBuilder builder{ graph };
+		builder.reserve (m_heads.size ());
+		for (size_t v{ 0 }; v < m_verticesCount; v++)
+		{
+			for (size_t a{ m_firstArcs[v] }; a < m_firstArcs[v + 1]; a++)
+			{
+				builder.addEdge (v, m_heads[a], residuals[a]);
+			}
+		}
+		builder.build ();
+		return graph;
+	}
+
+	size_t FlowEdgeList::arcsCount () const
+	{
+		ensureArcs ();
+		return m_heads.size ();
+	}
+
+	size_t FlowEdgeList::arc (size_t _edge) const
+	{
+		ensureArcs ();
+		return m_edgeArcs[_edge];
+	}
+
+	flow_t FlowEdgeList::capacity (size_t _from, size_t _to) const
+	{
+		ensureArcs ();
+		const auto begin{ m_heads.begin () + m_firstArcs[_from] }, end{ m_heads.begin () + m_firstArcs[_from + 1] };
+		const auto it{ std::lower_bound (begin, end, _to) };
+		return it != end && *it == _to ? m_arcCapacities[it - m_heads.begin ()] : 0;
+	}
+
+	void FlowEdgeList::updateFlows (const ResidualGraph& _residualGraph)
+	{
+		ensureArcs ();
+		if (_residualGraph.verticesCount () != m_verticesCount)
+		{
+			throw std::logic_error{ "vertices count mismatch" };
+		}
+		// Solvers may have reordered or removed residual edges, so each vertex maps its heads to its arcs once; missing arcs have no residual capacity
+		std::vector<flow_t> residuals (m_heads.size (), 0);
+		std::vector<size_t> owners (m_verticesCount, noArc), arcs (m_verticesCount);
+		for (size_t v{ 0 }; v < m_verticesCount; v++)
+		{
+			for (size_t a{ m_firstArcs[v] }; a < m_firstArcs[v + 1]; a++)
+			{
+				owners[m_heads[a]] = v;
+				arcs[m_heads[a]] = a;
+			}
+			for (const ResidualEdge& edge : _residualGraph[v])
+			{
+				if (owners[edge.to ().index ()] != v)
+				{
+					throw std::logic_error{ "unknown residual arc" };
+				}
+				residuals[arcs[edge.to ().index ()]] = *edge;
+			}
+		}
+		// Net flow along each arc, handed out to its edges in order
+		for (size_t a{ 0 }; a < m_heads.size (); a++)
+		{
+			residuals[a] = m_arcCapacities[a] > residuals[a] ? m_arcCapacities[a] - residuals[a] : 0;
+		}
+		for (size_t e{ 0 }; e < m_edges.size (); e++)
+		{
+			flow_t& netFlow{ residuals[m_edgeArcs[e]] };
+			m_edges[e].flow = std::min (m_edges[e].capacity, netFlow);
+			netFlow -= m_edges[e].flow;
+		}
+	}
+
+}
\ No newline at end of file
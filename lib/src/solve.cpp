@@ -4,12 +4,16 @@
 #include <max-flow/solvers/labeling/capacity_scaling.hpp>
 #include <max-flow/solvers/labeling/ford_fulkerson.hpp>
 #include <max-flow/solvers/labeling/shortest_path.hpp>
+#include <max-flow/solvers/labeling/unit_capacity.hpp>
 #include <max-flow/solvers/preflow_push/naif.hpp>
 #include <max-flow/solvers/preflow_push/fifo.hpp>
+#include <max-flow/solvers/preflow_push/discharge_fifo.hpp>
 #include <max-flow/solvers/preflow_push/highest_label.hpp>
 #include <max-flow/solvers/preflow_push/excess_scaling.hpp>
+#include <max-flow/solvers/preflow_push/naif_excess_scaling.hpp>
 #include <stdexcept>
 #include <vector>
+#include <algorithm>
 
 using namespace MaxFlow::Graphs;
 
@@ -35,6 +39,10 @@ namespace MaxFlow
 	Solver* createSolver(Graphs::ResidualGraph& _graph, Graphs::ResidualVertex& _source, Graphs::ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix, ESolver _solver, ESolverFlags _flags)
 	{
 		ResidualGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
+		if ((_flags & ESolverFlags::DetectUnitCapacities) && _solver != ESolver::UnitCapacity && Solvers::Labeling::UnitCapacitySolver::hasUnitCapacities(_graph, _capacityMatrix))
+		{
+			_solver = ESolver::UnitCapacity;
+		}
 		Solver* pSolver;
 		switch (_solver)
 		{
@@ -42,11 +50,14 @@ namespace MaxFlow
 		{
 			auto pFFSolver = new Solvers::Labeling::FordFulkersonSolver{ _graph, _source, _sink, _capacityMatrix };
 			pFFSolver->setDepthFirst(_flags & ESolverFlags::FordFulkersonDepthFirst);
+			pFFSolver->setBidirectional(_flags & ESolverFlags::FordFulkersonBidirectional);
 			pSolver = pFFSolver;
 			break;
 		}
 		case MaxFlow::ESolver::CapacityScalingFordFulkerson:
 		case MaxFlow::ESolver::CapacityScalingShortestPath:
+		case MaxFlow::ESolver::CapacityScalingFifoPreflowPush:
+		case MaxFlow::ESolver::CapacityScalingHighestLabelPreflowPush:
 		{
 			auto pCSSolver{ new Solvers::Labeling::CapacityScalingSolver{ _graph, _source, _sink, _capacityMatrix } };
 			switch (_solver)
@@ -57,10 +68,17 @@ namespace MaxFlow
 			case MaxFlow::ESolver::CapacityScalingShortestPath:
 				pCSSolver->setSubSolver(Solvers::Labeling::CapacityScalingSolver::ESubSolver::ShortestPath);
 				break;
+			case MaxFlow::ESolver::CapacityScalingFifoPreflowPush:
+				pCSSolver->setSubSolver(Solvers::Labeling::CapacityScalingSolver::ESubSolver::FifoPreflowPush);
+				break;
+			case MaxFlow::ESolver::CapacityScalingHighestLabelPreflowPush:
+				pCSSolver->setSubSolver(Solvers::Labeling::CapacityScalingSolver::ESubSolver::HighestLabelPreflowPush);
+				break;
 			}
 			pCSSolver->setRemoveDeltaEdges(_flags & ESolverFlags::CapacityScalingRemoveDeltaEdges);
 			pCSSolver->setMinCutDetection(_flags & ESolverFlags::ShortestPathDetectMinCut);
 			pCSSolver->setDepthFirst(_flags & ESolverFlags::FordFulkersonDepthFirst);
+			pCSSolver->setBidirectional(_flags & ESolverFlags::FordFulkersonBidirectional);
 			pSolver = pCSSolver;
 			break;
 		}
@@ -81,6 +99,13 @@ namespace MaxFlow
 			pSolver = new Solvers::PreflowPush::FifoPreflowPushSolver{ _graph, _source, _sink, _capacityMatrix };
 			break;
 		}
+		case MaxFlow::ESolver::DischargeFifoPreflowPush:
+		{
+			auto pDFSolver = new Solvers::PreflowPush::DischargeFifoPreflowPushSolver{ _graph, _source, _sink, _capacityMatrix };
+			pDFSolver->setWave(_flags & ESolverFlags::DischargeFifoWave);
+			pSolver = pDFSolver;
+			break;
+		}
 		case MaxFlow::ESolver::HighestLabelPreflowPush:
 		{
 			pSolver = new Solvers::PreflowPush::HighestLabelPreflowPushSolver{ _graph, _source, _sink, _capacityMatrix };
@@ -91,6 +116,16 @@ namespace MaxFlow
 			pSolver = new Solvers::PreflowPush::ExcessScalingPreflowPushSolver{ _graph, _source, _sink, _capacityMatrix };
 			break;
 		}
+		case MaxFlow::ESolver::NaifExcessScalingPreflowPush:
+		{
+			pSolver = new Solvers::PreflowPush::NaifExcessScalingPreflowPushSolver{ _graph, _source, _sink, _capacityMatrix };
+			break;
+		}
+		case MaxFlow::ESolver::UnitCapacity:
+		{
+			pSolver = new Solvers::Labeling::UnitCapacitySolver{ _graph, _source, _sink, _capacityMatrix };
+			break;
+		}
 		default:
 			throw std::invalid_argument{ "unknown solver" };
 		}
@@ -105,8 +140,100 @@ namespace MaxFlow
 		delete pSolver;
 	}
 
+	void solve(FlowEdgeList& _edgeList, size_t _source, size_t _sink, ESolver _solver, ESolverFlags _flags)
+	{
+		ResidualGraph residualGraph{ _edgeList.createResidualGraph() };
+		solve(residualGraph, residualGraph[_source], residualGraph[_sink], EdgeListCapacityMatrix{ _edgeList }, _solver, _flags);
+		_edgeList.updateFlows(residualGraph);
+	}
+
+	SolverContext::SolverContext(ESolver _solver, ESolverFlags _flags) : m_solver{ _solver }, m_flags{ _flags }
+	{}
+
+	SolverContext::~SolverContext()
+	{
+		clear();
+	}
+
+	ESolver SolverContext::solver() const
+	{
+		return m_solver;
+	}
+
+	ESolverFlags SolverContext::flags() const
+	{
+		return m_flags;
+	}
+
+	void SolverContext::solve(ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix)
+	{
+		if (!m_pSolver || &m_pSolver->graph() != &_graph || &m_pSolver->source() != &_source || &m_pSolver->sink() != &_sink || &m_pSolver->capacities() != &_capacityMatrix)
+		{
+			clear();
+			m_pSolver = createSolver(_graph, _source, _sink, _capacityMatrix, m_solver, m_flags);
+		}
+		m_pSolver->setCancellationToken(m_pCancellationToken);
+		m_pSolver->setProgressCallback(*m_pProgressCallback);
+		m_pSolver->setProgressInterval(m_progressInterval);
+		m_pSolver->solve();
+	}
+
+	const Utils::CancellationToken* SolverContext::cancellationToken() const
+	{
+		return m_pCancellationToken;
+	}
+
+	void SolverContext::setCancellationToken(const Utils::CancellationToken* _pCancellationToken)
+	{
+		m_pCancellationToken = _pCancellationToken;
+	}
+
+	Solver::ProgressCallback& SolverContext::progressCallback() const
+	{
+		return *m_pProgressCallback;
+	}
+
+	void SolverContext::setProgressCallback(Solver::ProgressCallback& _callback)
+	{
+		m_pProgressCallback = &_callback;
+	}
+
+	std::chrono::steady_clock::duration SolverContext::progressInterval() const
+	{
+		return m_progressInterval;
+	}
+
+	void SolverContext::setProgressInterval(std::chrono::steady_clock::duration _interval)
+	{
+		m_progressInterval = _interval;
+	}
+
+	bool SolverContext::wasCancelled() const
+	{
+		if (!m_pSolver)
+		{
+			throw std::logic_error{ "not solved" };
+		}
+		return m_pSolver->wasCancelled();
+	}
+
+	flow_t SolverContext::flowValue() const
+	{
+		if (!m_pSolver)
+		{
+			throw std::logic_error{ "not solved" };
+		}
+		return m_pSolver->flowValue();
+	}
+
+	void SolverContext::clear()
+	{
+		delete m_pSolver;
+		m_pSolver = nullptr;
+	}
+
 	Solver::Solver(ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix)
-		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_capacities{ _capacityMatrix }, m_areZeroEdgesRemoved{ false }
+		: m_graph{ _graph }, m_source{ _source }, m_sink{ _sink }, m_capacities{ _capacityMatrix }, m_areZeroEdgesRemoved{ false }, m_compactGraph{}
 	{
 		ResidualGraph::ensureSameGraph(_graph, _source.graph(), _sink.graph());
 		if (_source == _sink)
@@ -150,6 +277,28 @@ namespace MaxFlow
 		return m_capacities;
 	}
 
+	const CompactResidualGraph& Solver::compactGraph() const
+	{
+		return m_compactGraph;
+	}
+
+	CompactResidualGraph& Solver::compactGraph()
+	{
+		return m_compactGraph;
+	}
+
+	void Solver::loadCompactGraph()
+	{
+		m_compactGraph.assign(m_graph);
+		m_isCompactGraphLoaded = true;
+	}
+
+	void Solver::storeCompactGraph()
+	{
+		m_compactGraph.writeBack(m_graph, areZeroEdgesRemoved());
+		m_isCompactGraphLoaded = false;
+	}
+
 	void Solver::setRemoveZeroEdges(bool _removeZeroEdges)
 	{
 		m_areZeroEdgesRemoved = _removeZeroEdges;
@@ -173,7 +322,199 @@ namespace MaxFlow
 			Algorithms::removeBiZeroEdges(m_graph);
 		}
 		*/
+		resetSolveState();
 		solveImpl();
+		// Flow into the sink, read from the residual arcs leaving it
+		m_flowValue = 0;
+		for (const ResidualEdge& edge : m_sink)
+		{
+			m_flowValue += *edge;
+			m_flowValue -= m_capacities.capacity(m_sink.index(), edge.to().index());
+		}
+	}
+
+	void Solver::resetSolveState()
+	{
+		m_cancelled = false;
+		m_cancellationPolls = 0;
+		m_nextProgress = std::chrono::steady_clock::now() + m_progressInterval;
+		m_terminalCapacity = Progress::unbounded;
+		m_gapDistanceCounts.reserve(m_graph.verticesCount() + 1);
+	}
+
+	bool Solver::wasCancelled() const
+	{
+		return m_cancelled;
+	}
+
+	flow_t Solver::flowValue() const
+	{
+		return m_flowValue;
+	}
+
+	const Utils::CancellationToken* Solver::cancellationToken() const
+	{
+		return m_pCancellationToken;
+	}
+
+	void Solver::setCancellationToken(const Utils::CancellationToken* _pCancellationToken)
+	{
+		m_pCancellationToken = _pCancellationToken;
+	}
+
+	bool Solver::stopRequested()
+	{
+		if (!m_cancelled && m_pCancellationToken && m_pCancellationToken->isCancelled())
+		{
+			m_cancelled = true;
+		}
+		if (m_pProgressCallback != &ProgressCallback::none)
+		{
+			const std::chrono::steady_clock::time_point now{ std::chrono::steady_clock::now() };
+			if (now >= m_nextProgress)
+			{
+				m_nextProgress = now + m_progressInterval;
+				reportProgress();
+			}
+		}
+		return m_cancelled;
+	}
+
+	void Solver::reportProgress()
+	{
+		Progress progress{ .flow{ progressFlow() }, .upperBound{ progressUpperBound() } };
+		progress.upperBound = std::max(progress.upperBound, progress.flow);
+		m_pProgressCallback->onProgress(*this, progress);
+	}
+
+	void Solver::reportAugment(flow_t _amount)
+	{
+		m_pProgressCallback->onAugment(*this, _amount);
+	}
+
+	flow_t Solver::progressFlow()
+	{
+		flow_t flow{};
+		if (m_isCompactGraphLoaded)
+		{
+			const size_t sinkIndex{ m_sink.index() };
+			for (size_t arc{ m_compactGraph.firstArc(sinkIndex) }; arc < m_compactGraph.endArc(sinkIndex); arc++)
+			{
+				flow += m_compactGraph.residual(arc);
+				flow -= m_capacities.capacity(sinkIndex, m_compactGraph.head(arc));
+			}
+		}
+		else
+		{
+			for (const ResidualEdge& edge : m_sink)
+			{
+				flow += *edge;
+				flow -= m_capacities.capacity(m_sink.index(), edge.to().index());
+			}
+		}
+		return flow;
+	}
+
+	flow_t Solver::progressUpperBound()
+	{
+		if (m_terminalCapacity == Progress::unbounded)
+		{
+			// Computed once per solve on the first report, through the matrix since zero residual edges may have been removed
+			flow_t sourceCapacity{}, sinkCapacity{};
+			for (size_t v{ 0 }; v < m_graph.verticesCount(); v++)
+			{
+				sourceCapacity += m_capacities.capacity(m_source.index(), v);
+				sinkCapacity += m_capacities.capacity(v, m_sink.index());
+			}
+			m_terminalCapacity = std::min(sourceCapacity, sinkCapacity);
+		}
+		return m_terminalCapacity;
+	}
+
+	flow_t Solver::gapCutCapacity(const size_t* _distances)
+	{
+		const size_t verticesCount{ m_compactGraph.verticesCount() };
+		const size_t sourceDistance{ _distances[m_source.index()] };
+		if (sourceDistance > verticesCount)
+		{
+			return Progress::unbounded;
+		}
+		std::vector<size_t>& distanceCounts{ m_gapDistanceCounts };
+		distanceCounts.assign(sourceDistance, 0);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (_distances[v] < sourceDistance)
+			{
+				distanceCounts[_distances[v]]++;
+			}
+		}
+		size_t gap{ 1 };
+		while (gap < sourceDistance && distanceCounts[gap])
+		{
+			gap++;
+		}
+		if (gap >= sourceDistance)
+		{
+			return Progress::unbounded;
+		}
+		flow_t capacity{};
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (_distances[v] > gap)
+			{
+				for (size_t arc{ m_compactGraph.firstArc(v) }; arc < m_compactGraph.endArc(v); arc++)
+				{
+					if (_distances[m_compactGraph.head(arc)] < gap)
+					{
+						capacity += m_capacities.capacity(v, m_compactGraph.head(arc));
+					}
+				}
+			}
+		}
+		return capacity;
+	}
+
+	const Solver::ProgressCallback& Solver::progressCallback() const
+	{
+		return *m_pProgressCallback;
+	}
+
+	Solver::ProgressCallback& Solver::progressCallback()
+	{
+		return *m_pProgressCallback;
+	}
+
+	void Solver::setProgressCallback(ProgressCallback& _callback)
+	{
+		m_pProgressCallback = &_callback;
+	}
+
+	std::chrono::steady_clock::duration Solver::progressInterval() const
+	{
+		return m_progressInterval;
+	}
+
+	void Solver::setProgressInterval(std::chrono::steady_clock::duration _interval)
+	{
+		m_progressInterval = _interval;
+	}
+
+	void Solver::ProgressCallback::onProgress(const Solver& _solver, const Progress& _progress)
+	{}
+
+	void Solver::ProgressCallback::onAugment(const Solver& _solver, flow_t _amount)
+	{}
+
+	Solver::ProgressCallback Solver::ProgressCallback::none{};
+
+	bool Solver::stopRequestedPeriodically()
+	{
+		if (++m_cancellationPolls < cancellationPollInterval)
+		{
+			return m_cancelled;
+		}
+		m_cancellationPolls = 0;
+		return stopRequested();
 	}
 
 	flow_t CapacityMatrix::operator[](const Base::Edge& _edge) const
@@ -181,4 +522,12 @@ namespace MaxFlow
 		return capacity(_edge.from().index(), _edge.to().index());
 	}
 
+	EdgeListCapacityMatrix::EdgeListCapacityMatrix(const FlowEdgeList& _edgeList) : m_edgeList{ _edgeList }
+	{}
+
+	flow_t EdgeListCapacityMatrix::capacity(size_t _from, size_t _to) const
+	{
+		return m_edgeList.capacity(_from, _to);
+	}
+
 }
\ No newline at end of file
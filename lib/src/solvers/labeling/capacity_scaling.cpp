@@ -3,8 +3,11 @@
 #include <max-flow/graphs/algorithms/residual.hpp>
 #include <max-flow/solvers/labeling/ford_fulkerson.hpp>
 #include <max-flow/solvers/labeling/shortest_path.hpp>
+#include <max-flow/solvers/preflow_push/fifo.hpp>
+#include <max-flow/solvers/preflow_push/highest_label.hpp>
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
 
 using MaxFlow::Graphs::ResidualGraph;
 using MaxFlow::Graphs::ResidualVertex;
@@ -38,12 +41,73 @@ namespace MaxFlow::Solvers::Labeling
 
 	void CapacityScalingSolver::solveImpl ()
 	{
-		ResidualGraph deltaGraphStorage;
-		if (areDeltaEdgesRemoved ())
+		if (subSolver () == ESubSolver::FifoPreflowPush || subSolver () == ESubSolver::HighestLabelPreflowPush)
 		{
-			deltaGraphStorage.setMatrix (true);
-			deltaGraphStorage.addVertices (graph ().verticesCount ());
+			solvePreflowPush ();
 		}
+		else if (areDeltaEdgesRemoved () && subSolver () == ESubSolver::ShortestPath)
+		{
+			solveShortestPath ();
+		}
+		else if (areDeltaEdgesRemoved ())
+		{
+			solveOnDeltaView ();
+		}
+		else
+		{
+			solveWithSubSolver ();
+		}
+	}
+
+	CapacityScalingSolver::~CapacityScalingSolver ()
+	{
+		delete m_pSubSolver;
+	}
+
+	Solver& CapacityScalingSolver::subSolverInstance ()
+	{
+		if (!m_pSubSolver || m_subSolverType != subSolver ())
+		{
+			delete m_pSubSolver;
+			m_pSubSolver = nullptr;
+			switch (subSolver ())
+			{
+				case ESubSolver::FordFulkerson:
+					m_pSubSolver = new FordFulkersonSolver{ graph (), source (), sink (), capacities () };
+					break;
+				case ESubSolver::ShortestPath:
+					m_pSubSolver = new ShortestPathSolver{ graph (), source (), sink (), capacities () };
+					break;
+				case ESubSolver::FifoPreflowPush:
+					m_pSubSolver = new PreflowPush::FifoPreflowPushSolver{ graph (), source (), sink (), capacities () };
+					break;
+				case ESubSolver::HighestLabelPreflowPush:
+					m_pSubSolver = new PreflowPush::HighestLabelPreflowPushSolver{ graph (), source (), sink (), capacities () };
+					break;
+				default:
+					throw std::invalid_argument{ "unknown sub solver" };
+			}
+			m_subSolverType = subSolver ();
+		}
+		if (subSolver () == ESubSolver::FordFulkerson)
+		{
+			FordFulkersonSolver& fordFulkersonSolver{ static_cast<FordFulkersonSolver&> (*m_pSubSolver) };
+			fordFulkersonSolver.setDepthFirst (depthFirst ());
+			fordFulkersonSolver.setBidirectional (bidirectional ());
+		}
+		else if (subSolver () == ESubSolver::ShortestPath)
+		{
+			static_cast<ShortestPathSolver&> (*m_pSubSolver).setMinCutDetection (isMinCutDetectionEnabled ());
+		}
+		m_pSubSolver->setRemoveZeroEdges (areZeroEdgesRemoved ());
+		m_pSubSolver->setCancellationToken (cancellationToken ());
+		m_pSubSolver->setProgressCallback (progressCallback ());
+		m_pSubSolver->setProgressInterval (progressInterval ());
+		return *m_pSubSolver;
+	}
+
+	void CapacityScalingSolver::solveWithSubSolver ()
+	{
 		flow_t minCapacity{};
 		for (const ResidualVertex& vertex : graph ())
 		{
@@ -55,67 +119,120 @@ namespace MaxFlow::Solvers::Labeling
 				}
 			}
 		}
-		ResidualGraph& deltaGraph{ areDeltaEdgesRemoved () ? deltaGraphStorage : graph () };
-		PropagateCallback callback{ graph () };
-		deltaGraph.setMatrix (true);
-		LabelingSolver* pSubSolver;
-		switch (subSolver ())
+		LabelingSolver& labelingSolver{ static_cast<LabelingSolver&> (subSolverInstance ()) };
+		DeltaEdgeSelector edgeSelector;
+		labelingSolver.setEdgeSelector (edgeSelector);
+		edgeSelector.delta = static_cast<flow_t>(std::pow (2, std::floor (std::log2 (minCapacity))));
+		while (edgeSelector.delta >= 1 && !stopRequested ())
 		{
-			case ESubSolver::FordFulkerson:
+			labelingSolver.solve ();
+			if (labelingSolver.wasCancelled ())
 			{
-				FordFulkersonSolver* pFFSubSolver = new FordFulkersonSolver{ deltaGraph, deltaGraph[source ().index ()], deltaGraph[sink ().index ()], capacities () };
-				pFFSubSolver->setDepthFirst(depthFirst());
-				pSubSolver = pFFSubSolver;
+				// The token is shared, so this records the stop on this solver too
+				stopRequested ();
 				break;
 			}
-			case ESubSolver::ShortestPath:
-			{
-				ShortestPathSolver* pSPSubSolver = new ShortestPathSolver{ deltaGraph, deltaGraph[source ().index ()], deltaGraph[sink ().index ()], capacities () };
-				pSPSubSolver->setMinCutDetection (isMinCutDetectionEnabled ());
-				pSubSolver = pSPSubSolver;
-			}
-			break;
-			default:
-				throw std::invalid_argument{ "unknown sub solver" };
-		}
-		pSubSolver->setRemoveZeroEdges (areZeroEdgesRemoved ());
-		if (areDeltaEdgesRemoved ())
-		{
-			pSubSolver->setCallback (callback);
+			edgeSelector.delta /= 2;
 		}
-		DeltaEdgeSelector edgeSelector;
-		edgeSelector.delta = static_cast<flow_t>(std::pow (2, std::floor (std::log2 (minCapacity))));
-		while (edgeSelector.delta >= 1)
+		// The selector does not outlive this solve
+		labelingSolver.setEdgeSelector (EdgeSelector::all);
+	}
+
+	void CapacityScalingSolver::solveOnDeltaView ()
+	{
+		// Ford-Fulkerson sub solver: augments along any path of the delta view
+		loadCompactGraph ();
+		m_deltaView.reset ();
+		for (flow_t delta{ m_deltaView.maxDelta () }; delta >= 1 && !wasCancelled (); delta /= 2)
 		{
-			if (areDeltaEdgesRemoved ())
+			m_deltaView.setDelta (delta);
+			while (!stopRequested ())
 			{
-				for (ResidualVertex& vertex : graph ())
+				if (depthFirst ())
+				{
+					m_pathfinder.calculateDepthFirst (m_deltaView);
+				}
+				else if (bidirectional ())
+				{
+					m_pathfinder.calculateBidirectional (m_deltaView);
+				}
+				else
+				{
+					m_pathfinder.calculateBreadthFirst (m_deltaView);
+				}
+				if (!m_pathfinder.isSinkLabeled ())
 				{
-					ResidualVertex& deltaVertex{ deltaGraph[vertex.index ()] };
-					deltaVertex.destroyAllOutEdges ();
-					for (ResidualEdge& edge : vertex)
-					{
-						if (*edge >= edgeSelector.delta)
-						{
-							deltaVertex.addOutEdge (edge.to ().index (), *edge);
-						}
-					}
+					break;
 				}
+				const flow_t amount{ minCapacity (compactGraph (), m_pathfinder.begin (), m_pathfinder.end ()) };
+				for (const size_t arc : m_pathfinder)
+				{
+					m_deltaView.augment (arc, amount);
+				}
+				reportAugment (amount);
+			}
+		}
+		storeCompactGraph ();
+	}
+
+	void CapacityScalingSolver::solveShortestPath ()
+	{
+		// The sub solver labels the eligible arcs of the view at the start of each phase, which ends when the source label reaches the vertices count or, with min cut detection, at the first gap
+		ShortestPathSolver& shortestPathSolver{ static_cast<ShortestPathSolver&> (subSolverInstance ()) };
+		shortestPathSolver.resetSolveState ();
+		shortestPathSolver.loadCompactGraph ();
+		DeltaResidualView deltaView{ shortestPathSolver.compactGraph () };
+		deltaView.reset ();
+		for (flow_t delta{ deltaView.maxDelta () }; delta >= 1; delta /= 2)
+		{
+			deltaView.setDelta (delta);
+			shortestPathSolver.prepare (deltaView);
+			shortestPathSolver.run ();
+			if (shortestPathSolver.wasCancelled ())
+			{
+				// The token is shared, so this records the stop on this solver too
+				stopRequested ();
+				break;
 			}
-			pSubSolver->solve ();
-			edgeSelector.delta /= 2;
 		}
-		delete pSubSolver;
+		shortestPathSolver.storeCompactGraph ();
 	}
 
-	void CapacityScalingSolver::PropagateCallback::onAugment (const LabelingSolver& _solver, flow_t _amount)
+	void CapacityScalingSolver::solvePreflowPush ()
 	{
-		const Pathfinder::IteratorC start{ _solver.pathfinder ().begin () }, end{ _solver.pathfinder ().end () };
-		for (Pathfinder::IteratorC it{ start }; it != end; ++it)
+		// The engine keeps its distance labels, excesses and selection structures across phases; labels are only lowered where newly active arcs require it
+		PreflowPush::PreflowPushSolver& engine{ static_cast<PreflowPush::PreflowPushSolver&> (subSolverInstance ()) };
+		engine.resetSolveState ();
+		engine.loadCompactGraph ();
+		DeltaResidualView deltaView{ engine.compactGraph () };
+		deltaView.reset ();
+		flow_t delta{ deltaView.maxDelta () };
+		if (delta)
 		{
-			ResidualEdge& edge{ m_graph[it->from ().index ()][it->to ().index ()] };
-			augment (edge, _amount, _solver.areZeroEdgesRemoved ());
+			deltaView.setDelta (delta);
+			engine.prepare (deltaView);
+			while (true)
+			{
+				engine.saturateSourceEdges ();
+				engine.run ();
+				// Polled on the engine, whose compact graph holds the current flow
+				if (engine.wasCancelled () || (delta > 1 && engine.stopRequested ()))
+				{
+					stopRequested ();
+					break;
+				}
+				delta /= 2;
+				if (!delta)
+				{
+					break;
+				}
+				deltaView.setDelta (delta);
+				engine.repairLabels (deltaView.activatedArcs ());
+			}
+			// Excess parked by the last phase, or left by a stop, goes back to the source
+			engine.returnExcess ();
 		}
+		engine.storeCompactGraph ();
 	}
 
 	bool CapacityScalingSolver::isMinCutDetectionEnabled () const
@@ -128,12 +245,9 @@ namespace MaxFlow::Solvers::Labeling
 		m_detectMinCut = _enabled;
 	}
 
-	CapacityScalingSolver::PropagateCallback::PropagateCallback (Graphs::ResidualGraph& _graph) : m_graph{ _graph }
-	{}
-
-	bool CapacityScalingSolver::DeltaEdgeSelector::operator() (const ResidualEdge& _edge)
+	bool CapacityScalingSolver::DeltaEdgeSelector::operator() (const CompactResidualGraph& _graph, size_t _arc)
 	{
-		return *_edge >= delta;
+		return _graph.residual (_arc) >= delta;
 	}
 
 
@@ -147,4 +261,14 @@ namespace MaxFlow::Solvers::Labeling
 		m_depthFirst = _depthFirst;
 	}
 
+	bool CapacityScalingSolver::bidirectional() const
+	{
+		return m_bidirectional;
+	}
+
+	void CapacityScalingSolver::setBidirectional(bool _bidirectional)
+	{
+		m_bidirectional = _bidirectional;
+	}
+
 }
\ No newline at end of file
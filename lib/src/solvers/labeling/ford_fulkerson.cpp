@@ -6,15 +6,17 @@ namespace MaxFlow::Solvers::Labeling
 
 	void FordFulkersonSolver::solveImpl ()
 	{
+		loadCompactGraph ();
 		do
 		{
-			calculatePaths (m_depthFirst);
+			calculatePaths (m_depthFirst, m_bidirectional);
 			if (pathfinder ().isSinkLabeled ())
 			{
 				augmentMax ();
 			}
 		}
-		while (pathfinder ().isSinkLabeled ());
+		while (pathfinder ().isSinkLabeled () && !stopRequested ());
+		storeCompactGraph ();
 	}
 
 
@@ -28,4 +30,14 @@ namespace MaxFlow::Solvers::Labeling
 		m_depthFirst = _depthFirst;
 	}
 
+	bool FordFulkersonSolver::bidirectional() const
+	{
+		return m_bidirectional;
+	}
+
+	void FordFulkersonSolver::setBidirectional(bool _bidirectional)
+	{
+		m_bidirectional = _bidirectional;
+	}
+
 }
\ No newline at end of file
@@ -22,12 +22,16 @@ namespace MaxFlow::Solvers::Labeling
 		return m_pathfinder;
 	}
 
-	void LabelingSolver::calculatePaths(bool _depthFirst)
+	void LabelingSolver::calculatePaths(bool _depthFirst, bool _bidirectional)
 	{
 		if (_depthFirst)
 		{
 			m_pathfinder.calculateDepthFirst(edgeSelector());
 		}
+		else if (_bidirectional)
+		{
+			m_pathfinder.calculateBidirectional(edgeSelector());
+		}
 		else
 		{
 			m_pathfinder.calculateBreadthFirst(edgeSelector());
@@ -36,9 +40,19 @@ namespace MaxFlow::Solvers::Labeling
 
 	void LabelingSolver::augmentMax()
 	{
-		const flow_t amount{ minCapacity(m_pathfinder.begin(), m_pathfinder.end()) };
-		Graphs::Algorithms::augment(m_pathfinder.begin(), m_pathfinder.end(), amount, areZeroEdgesRemoved());
-		callback().onAugment(*this, amount);
+		const flow_t amount{ Graphs::Algorithms::minCapacity(compactGraph(), m_pathfinder.begin(), m_pathfinder.end()) };
+		Graphs::Algorithms::augment(compactGraph(), m_pathfinder.begin(), m_pathfinder.end(), amount);
+		reportAugment(amount);
+	}
+
+	void LabelingSolver::augmentMax(Graphs::DeltaResidualView& _deltaView)
+	{
+		const flow_t amount{ Graphs::Algorithms::minCapacity(compactGraph(), m_pathfinder.begin(), m_pathfinder.end()) };
+		for (const size_t arc : m_pathfinder)
+		{
+			_deltaView.augment(arc, amount);
+		}
+		reportAugment(amount);
 	}
 
 	const EdgeSelector& LabelingSolver::edgeSelector() const
@@ -56,24 +70,4 @@ namespace MaxFlow::Solvers::Labeling
 		m_pEdgeSelector = &_edgeSelector;
 	}
 
-	const LabelingSolver::Callback& LabelingSolver::callback() const
-	{
-		return *m_pCallback;
-	}
-
-	LabelingSolver::Callback& LabelingSolver::callback()
-	{
-		return *m_pCallback;
-	}
-
-	void LabelingSolver::setCallback(Callback& _callback)
-	{
-		m_pCallback = &_callback;
-	}
-
-	void LabelingSolver::Callback::onAugment(const LabelingSolver& _solver, flow_t _amount)
-	{}
-
-	LabelingSolver::Callback LabelingSolver::Callback::none{};
-
 }
\ No newline at end of file
@@ -1,15 +1,38 @@
 #include <max-flow/solvers/labeling/shortest_path.hpp>
 
+#include <max-flow/graphs/algorithms/arc_scan.hpp>
 #include <limits>
+#include <algorithm>
+#include <span>
 
-using MaxFlow::Graphs::ResidualGraph;
-using MaxFlow::Graphs::ResidualVertex;
-using MaxFlow::Graphs::ResidualEdge;
+using MaxFlow::Graphs::CompactResidualGraph;
+using MaxFlow::Graphs::DeltaResidualView;
+using MaxFlow::Graphs::Algorithms::EdgeSelector;
 using Label = MaxFlow::Graphs::Algorithms::DistanceLabeler::Label;
 
 namespace MaxFlow::Solvers::Labeling
 {
 
+	namespace
+	{
+
+		struct EligibleArcSelector final : public EdgeSelector
+		{
+
+			const DeltaResidualView& view;
+
+			EligibleArcSelector (const DeltaResidualView& _view) : view{ _view }
+			{}
+
+			bool operator() (const CompactResidualGraph& _graph, size_t _arc) override
+			{
+				return view.isEligible (_arc);
+			}
+
+		};
+
+	}
+
 	bool ShortestPathSolver::isMinCutDetectionEnabled() const
 	{
 		return m_detectMinCut;
@@ -20,66 +43,166 @@ namespace MaxFlow::Solvers::Labeling
 		m_detectMinCut = _enabled;
 	}
 
+	size_t ShortestPathSolver::findAdmissibleArc(size_t _vertex, size_t _distance)
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		size_t& currentArc{ m_currentArcs[_vertex] };
+		if (m_pDeltaView)
+		{
+			// Arcs activated later are appended to the list, so they are still ahead of the current arc
+			const std::span<const size_t> arcs{ m_pDeltaView->arcs(_vertex) };
+			for (; currentArc < arcs.size(); currentArc++)
+			{
+				const size_t arc{ arcs[currentArc] };
+				if (m_pDeltaView->isEligible(arc) && distances[residualGraph.head(arc)] == _distance - 1)
+				{
+					return arc;
+				}
+			}
+			return CompactResidualGraph::noArc;
+		}
+		const size_t firstArc{ residualGraph.firstArc(_vertex) };
+		if (&edgeSelector() == &EdgeSelector::all)
+		{
+			const size_t arc{ Graphs::Algorithms::findArcToDistance(residualGraph, distances, _vertex, _distance - 1, firstArc + currentArc) };
+			currentArc = (arc == CompactResidualGraph::noArc ? residualGraph.endArc(_vertex) : arc) - firstArc;
+			return arc;
+		}
+		for (; firstArc + currentArc < residualGraph.endArc(_vertex); currentArc++)
+		{
+			const size_t arc{ firstArc + currentArc };
+			if (m_distanceLabeler.isAdmissible(_vertex, arc) && edgeSelector()(residualGraph, arc))
+			{
+				return arc;
+			}
+		}
+		return CompactResidualGraph::noArc;
+	}
+
+	size_t ShortestPathSolver::minNeighborDistance(size_t _vertex)
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		size_t minDistance{ std::numeric_limits<size_t>::max() };
+		if (m_pDeltaView)
+		{
+			for (const size_t arc : m_pDeltaView->arcs(_vertex))
+			{
+				if (m_pDeltaView->isEligible(arc))
+				{
+					minDistance = std::min(minDistance, distances[residualGraph.head(arc)]);
+				}
+			}
+			return minDistance;
+		}
+		if (&edgeSelector() == &EdgeSelector::all)
+		{
+			return Graphs::Algorithms::minHeadDistance(residualGraph, distances, _vertex);
+		}
+		for (size_t arc{ residualGraph.firstArc(_vertex) }; arc < residualGraph.endArc(_vertex); arc++)
+		{
+			if (residualGraph.residual(arc) && m_distanceLabeler[residualGraph.head(arc)] < minDistance && edgeSelector() (residualGraph, arc))
+			{
+				minDistance = *m_distanceLabeler[residualGraph.head(arc)];
+			}
+		}
+		return minDistance;
+	}
+
+	Graphs::flow_t ShortestPathSolver::progressUpperBound()
+	{
+		// Labels restricted to some arcs say nothing about the cuts of the whole graph
+		const Graphs::flow_t bound{ LabelingSolver::progressUpperBound() };
+		if (m_pDeltaView || &edgeSelector() != &EdgeSelector::all)
+		{
+			return bound;
+		}
+		return std::min(bound, gapCutCapacity(m_distanceLabeler.distances()));
+	}
+
 	void ShortestPathSolver::solveImpl()
 	{
-		m_distanceLabeler.calculate(edgeSelector());
+		loadCompactGraph();
+		m_pDeltaView = nullptr;
+		prepare(edgeSelector());
+		run();
+		storeCompactGraph();
+	}
+
+	void ShortestPathSolver::prepare(EdgeSelector& _edgeSelector)
+	{
+		const size_t verticesCount{ compactGraph().verticesCount() };
+		m_distanceLabeler.calculate(_edgeSelector);
 		if (isMinCutDetectionEnabled())
 		{
 			m_distanceCounts.clear();
-			m_distanceCounts.resize(graph().verticesCount(), 0);
-			for (const ResidualVertex& vertex : graph())
+			m_distanceCounts.resize(verticesCount, 0);
+			for (size_t v{ 0 }; v < verticesCount; v++)
 			{
-				const Label label{ m_distanceLabeler[vertex] };
+				const Label label{ m_distanceLabeler[v] };
 				if (label.valid())
 				{
 					m_distanceCounts[*label]++;
 				}
 			}
 		}
+		m_currentArcs.assign(verticesCount, 0);
+	}
+
+	void ShortestPathSolver::prepare(DeltaResidualView& _deltaView)
+	{
+		m_pDeltaView = &_deltaView;
+		EligibleArcSelector edgeSelector{ _deltaView };
+		prepare(edgeSelector);
+	}
+
+	void ShortestPathSolver::run()
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t verticesCount{ residualGraph.verticesCount() };
 		pathfinder().reset();
-		pathfinder().setPredecessor(source(), source());
-		ResidualVertex* pCurrent{ &source() };
-		while (m_distanceLabeler[source()] < graph().verticesCount())
+		pathfinder().resetPredecessor(source().index());
+		size_t current{ source().index() };
+		// Flow only changes on complete augmenting paths, so stopping between two steps leaves a valid flow
+		while (m_distanceLabeler[source().index()] < verticesCount && !stopRequestedPeriodically())
 		{
-			const size_t distance{ *m_distanceLabeler[*pCurrent] };
-			bool foundAdmissibleEdge{ false };
-			for (ResidualEdge& edge : *pCurrent)
+			const size_t distance{ *m_distanceLabeler[current] };
+			const size_t arc{ distance ? findAdmissibleArc(current, distance) : CompactResidualGraph::noArc };
+			if (arc != CompactResidualGraph::noArc)
 			{
-				if (m_distanceLabeler.isAdmissible(edge) && edgeSelector()(edge))
+				pathfinder().setPredecessor(arc);
+				current = residualGraph.head(arc);
+				if (current == sink().index())
 				{
-					pathfinder().setPredecessor(edge);
-					pCurrent = &edge.to();
-					if (pCurrent == &sink())
+					if (m_pDeltaView)
+					{
+						augmentMax(*m_pDeltaView);
+					}
+					else
 					{
 						augmentMax();
-						pCurrent = &source();
 					}
-					foundAdmissibleEdge = true;
-					break;
+					current = source().index();
 				}
 			}
-			if (!foundAdmissibleEdge)
+			else
 			{
-				size_t minDistance{ std::numeric_limits<size_t>::max() };
-				bool hasOutEdges{};
-				for (ResidualEdge& edge : *pCurrent)
+				// A vertex without usable arcs, common among the eligible arcs of a scaling phase, can no longer reach the sink
+				const size_t minDistance{ minNeighborDistance(current) };
+				const size_t newDistance{ minDistance == std::numeric_limits<size_t>::max() ? verticesCount : minDistance + 1 };
+				m_distanceLabeler.setDistance(current, newDistance);
+				m_currentArcs[current] = 0;
+				current = pathfinder()[current];
+				if (isMinCutDetectionEnabled())
 				{
-					if (*edge && m_distanceLabeler[edge.to()] < minDistance && edgeSelector() (edge))
+					// Relabeling can lift a vertex to verticesCount or above, past the initial distances
+					if (newDistance >= m_distanceCounts.size())
 					{
-						hasOutEdges = true;
-						minDistance = *m_distanceLabeler[edge.to()];
+						m_distanceCounts.resize(newDistance + 1, 0);
 					}
-				}
-				if (!hasOutEdges)
-				{
-					break;
-				}
-				m_distanceLabeler.setDistance(*pCurrent, minDistance + 1);
-				pCurrent = &pathfinder()[*pCurrent];
-				if (isMinCutDetectionEnabled())
-				{
 					m_distanceCounts[distance]--;
-					m_distanceCounts[minDistance + 1]++;
+					m_distanceCounts[newDistance]++;
 					if (!m_distanceCounts[distance])
 					{
 						break;
@@ -0,0 +1,212 @@
+#include <max-flow/solvers/labeling/unit_capacity.hpp>
+
+#include <max-flow/graphs/algorithms/residual.hpp>
+#include <limits>
+#include <stdexcept>
+
+using MaxFlow::Graphs::ResidualGraph;
+using MaxFlow::Graphs::ResidualVertex;
+using MaxFlow::Graphs::ResidualEdge;
+using MaxFlow::Graphs::flow_t;
+
+namespace MaxFlow::Solvers::Labeling
+{
+
+	constexpr size_t noLevel{ std::numeric_limits<size_t>::max () };
+
+	bool UnitCapacitySolver::hasUnitCapacities (const ResidualGraph& _graph, const CapacityMatrix& _capacityMatrix)
+	{
+		for (const ResidualVertex& vertex : _graph)
+		{
+			for (const ResidualEdge& edge : vertex)
+			{
+				if (_capacityMatrix.capacity (vertex.index (), edge.to ().index ()) > 1 || _capacityMatrix.capacity (edge.to ().index (), vertex.index ()) > 1)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	void UnitCapacitySolver::build ()
+	{
+		if (!hasUnitCapacities (graph (), capacities ()))
+		{
+			throw std::logic_error{ "not unit capacities" };
+		}
+		const size_t verticesCount{ graph ().verticesCount () };
+		m_tails.clear ();
+		m_heads.clear ();
+		m_flows.clear ();
+		for (const ResidualVertex& vertex : graph ())
+		{
+			for (const ResidualEdge& edge : vertex)
+			{
+				const size_t from{ vertex.index () }, to{ edge.to ().index () };
+				if (capacities ().capacity (from, to))
+				{
+					m_tails.push_back (from);
+					m_heads.push_back (to);
+					m_flows.push_back (!*edge);
+				}
+				if (capacities ().capacity (to, from) && !edge.antiParallelIfExists ())
+				{
+					m_tails.push_back (to);
+					m_heads.push_back (from);
+					m_flows.push_back (true);
+				}
+			}
+		}
+		m_firstHalfArcs.clear ();
+		m_firstHalfArcs.resize (verticesCount + 1, 0);
+		for (size_t a{ 0 }; a < m_tails.size (); a++)
+		{
+			m_firstHalfArcs[m_tails[a] + 1]++;
+			m_firstHalfArcs[m_heads[a] + 1]++;
+		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			m_firstHalfArcs[v + 1] += m_firstHalfArcs[v];
+		}
+		m_halfArcs.resize (m_tails.size () * 2);
+		m_currentHalfArcs.assign (m_firstHalfArcs.begin (), m_firstHalfArcs.end () - 1);
+		for (size_t a{ 0 }; a < m_tails.size (); a++)
+		{
+			m_halfArcs[m_currentHalfArcs[m_tails[a]]++] = 2 * a;
+			m_halfArcs[m_currentHalfArcs[m_heads[a]]++] = 2 * a + 1;
+		}
+		m_levels.resize (verticesCount);
+		m_queue.reserve (verticesCount);
+		m_path.reserve (verticesCount);
+	}
+
+	void UnitCapacitySolver::writeBack ()
+	{
+		for (size_t a{ 0 }; a < m_tails.size (); a++)
+		{
+			ResidualVertex& tail{ graph ()[m_tails[a]] }, & head{ graph ()[m_heads[a]] };
+			*Graphs::Algorithms::edgeOrCreate (tail, head) = 0;
+			*Graphs::Algorithms::edgeOrCreate (head, tail) = 0;
+		}
+		for (size_t a{ 0 }; a < m_tails.size (); a++)
+		{
+			ResidualVertex& tail{ graph ()[m_tails[a]] }, & head{ graph ()[m_heads[a]] };
+			*(m_flows[a] ? head[tail] : tail[head]) += 1;
+		}
+		if (areZeroEdgesRemoved ())
+		{
+			for (size_t a{ 0 }; a < m_tails.size (); a++)
+			{
+				ResidualVertex& tail{ graph ()[m_tails[a]] }, & head{ graph ()[m_heads[a]] };
+				for (ResidualEdge* pEdge : { tail.outEdgeIfExists (head), head.outEdgeIfExists (tail) })
+				{
+					if (pEdge && !**pEdge)
+					{
+						pEdge->destroy ();
+					}
+				}
+			}
+		}
+	}
+
+	size_t UnitCapacitySolver::from (size_t _halfArc) const
+	{
+		return _halfArc % 2 ? m_heads[_halfArc / 2] : m_tails[_halfArc / 2];
+	}
+
+	size_t UnitCapacitySolver::to (size_t _halfArc) const
+	{
+		return _halfArc % 2 ? m_tails[_halfArc / 2] : m_heads[_halfArc / 2];
+	}
+
+	bool UnitCapacitySolver::isResidual (size_t _halfArc) const
+	{
+		return m_flows[_halfArc / 2] == static_cast<bool>(_halfArc % 2);
+	}
+
+	bool UnitCapacitySolver::calculateLevels ()
+	{
+		std::fill (m_levels.begin (), m_levels.end (), noLevel);
+		m_queue.clear ();
+		m_levels[source ().index ()] = 0;
+		m_queue.push_back (source ().index ());
+		for (size_t q{ 0 }; q < m_queue.size () && m_levels[sink ().index ()] == noLevel; q++)
+		{
+			const size_t vertex{ m_queue[q] };
+			for (size_t i{ m_firstHalfArcs[vertex] }; i < m_firstHalfArcs[vertex + 1]; i++)
+			{
+				const size_t halfArc{ m_halfArcs[i] };
+				if (isResidual (halfArc) && m_levels[to (halfArc)] == noLevel)
+				{
+					m_levels[to (halfArc)] = m_levels[vertex] + 1;
+					m_queue.push_back (to (halfArc));
+				}
+			}
+		}
+		m_currentHalfArcs.assign (m_firstHalfArcs.begin (), m_firstHalfArcs.end () - 1);
+		return m_levels[sink ().index ()] != noLevel;
+	}
+
+	bool UnitCapacitySolver::augment ()
+	{
+		m_path.clear ();
+		size_t vertex{ source ().index () };
+		while (vertex != sink ().index ())
+		{
+			size_t& current{ m_currentHalfArcs[vertex] };
+			while (current < m_firstHalfArcs[vertex + 1]
+				&& !(isResidual (m_halfArcs[current]) && m_levels[to (m_halfArcs[current])] == m_levels[vertex] + 1))
+			{
+				current++;
+			}
+			if (current < m_firstHalfArcs[vertex + 1])
+			{
+				m_path.push_back (m_halfArcs[current]);
+				vertex = to (m_halfArcs[current]);
+			}
+			else
+			{
+				if (m_path.empty ())
+				{
+					return false;
+				}
+				m_levels[vertex] = noLevel;
+				vertex = from (m_path.back ());
+				m_path.pop_back ();
+				m_currentHalfArcs[vertex]++;
+			}
+		}
+		for (const size_t halfArc : m_path)
+		{
+			m_flows[halfArc / 2] = !m_flows[halfArc / 2];
+		}
+		return true;
+	}
+
+	flow_t UnitCapacitySolver::progressFlow ()
+	{
+		const size_t sinkIndex{ sink ().index () };
+		flow_t flow{};
+		for (size_t i{ m_firstHalfArcs[sinkIndex] }; i < m_firstHalfArcs[sinkIndex + 1]; i++)
+		{
+			const size_t arc{ m_halfArcs[i] / 2 };
+			if (m_flows[arc])
+			{
+				flow += m_heads[arc] == sinkIndex ? 1 : -1;
+			}
+		}
+		return flow;
+	}
+
+	void UnitCapacitySolver::solveImpl ()
+	{
+		build ();
+		while (!stopRequested () && calculateLevels ())
+		{
+			while (!stopRequestedPeriodically () && augment ());
+		}
+		writeBack ();
+	}
+
+}
\ No newline at end of file
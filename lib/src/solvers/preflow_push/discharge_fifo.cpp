@@ -0,0 +1,146 @@
+#include <max-flow/solvers/preflow_push/discharge_fifo.hpp>
+
+#include <algorithm>
+
+using MaxFlow::Graphs::flow_t;
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	void DischargeFifoPreflowPushSolver::initialize ()
+	{
+		m_excesses.clear ();
+		m_excesses.resize (compactGraph ().verticesCount (), 0);
+		m_activeVertices.reset (compactGraph ().verticesCount ());
+		m_first = none;
+	}
+
+	void DischargeFifoPreflowPushSolver::addExcess (size_t _arc, flow_t _amount)
+	{
+		const size_t to{ compactGraph ().head (_arc) }, from{ compactGraph ().tail (_arc) };
+		if (to != source ().index () && to != sink ().index ())
+		{
+			if (!m_wave && _amount)
+			{
+				m_activeVertices.push (to);
+			}
+			m_excesses[to] += _amount;
+		}
+		if (from != source ().index () && from != sink ().index ())
+		{
+			m_excesses[from] -= _amount;
+		}
+	}
+
+	PreflowPushSolver::Excess DischargeFifoPreflowPushSolver::getExcess ()
+	{
+		while (!m_activeVertices.empty ())
+		{
+			const size_t vertex{ m_activeVertices.front () };
+			if (m_excesses[vertex])
+			{
+				return { .vertex{vertex}, .amount{m_excesses[vertex]} };
+			}
+			m_activeVertices.pop ();
+		}
+		return {};
+	}
+
+	void DischargeFifoPreflowPushSolver::run ()
+	{
+		if (m_wave)
+		{
+			runWave ();
+		}
+		else
+		{
+			runFifo ();
+		}
+	}
+
+	void DischargeFifoPreflowPushSolver::runFifo ()
+	{
+		while (!m_activeVertices.empty () && !stopRequestedPeriodically ())
+		{
+			const size_t vertex{ m_activeVertices.front () };
+			m_activeVertices.pop ();
+			if (m_excesses[vertex])
+			{
+				discharge ({ .vertex{vertex}, .amount{m_excesses[vertex]} });
+			}
+		}
+	}
+
+	void DischargeFifoPreflowPushSolver::runWave ()
+	{
+		const size_t verticesCount{ compactGraph ().verticesCount () };
+		std::vector<size_t>& order{ m_order };
+		order.clear ();
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (v != source ().index () && v != sink ().index () && label (v).valid ())
+			{
+				order.push_back (v);
+			}
+		}
+		// Admissible arcs always lead to a label one lower, so decreasing labels are a topological order
+		std::sort (order.begin (), order.end (), [this] (size_t _a, size_t _b) { return *label (_a) > *label (_b); });
+		m_next.assign (verticesCount, none);
+		m_previous.assign (verticesCount, none);
+		for (size_t i{ 1 }; i < order.size (); i++)
+		{
+			m_next[order[i - 1]] = order[i];
+			m_previous[order[i]] = order[i - 1];
+		}
+		m_first = order.empty () ? none : order.front ();
+		bool discharged;
+		do
+		{
+			discharged = false;
+			size_t vertex{ m_first };
+			while (vertex != none && !stopRequestedPeriodically ())
+			{
+				const size_t next{ m_next[vertex] };
+				if (m_excesses[vertex])
+				{
+					discharged = true;
+					// A relabeled vertex has no incoming admissible arc, so putting it first keeps the order topological
+					if (discharge ({ .vertex{vertex}, .amount{m_excesses[vertex]} }))
+					{
+						moveToFront (vertex);
+					}
+				}
+				vertex = next;
+			}
+		}
+		while (discharged && !wasCancelled ());
+	}
+
+	void DischargeFifoPreflowPushSolver::moveToFront (size_t _vertex)
+	{
+		if (_vertex == m_first)
+		{
+			return;
+		}
+		m_next[m_previous[_vertex]] = m_next[_vertex];
+		if (m_next[_vertex] != none)
+		{
+			m_previous[m_next[_vertex]] = m_previous[_vertex];
+		}
+		m_previous[_vertex] = none;
+		m_next[_vertex] = m_first;
+		m_previous[m_first] = _vertex;
+		m_first = _vertex;
+	}
+
+	bool DischargeFifoPreflowPushSolver::wave () const
+	{
+		return m_wave;
+	}
+
+	void DischargeFifoPreflowPushSolver::setWave (bool _wave)
+	{
+		m_wave = _wave;
+	}
+
+}
\ No newline at end of file
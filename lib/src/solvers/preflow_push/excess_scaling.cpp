@@ -1,9 +1,8 @@
 #include <max-flow/solvers/preflow_push/excess_scaling.hpp>
 
-#include <cmath>
-#include <algorithm>
+#include <bit>
+#include <limits>
 
-using MaxFlow::Graphs::ResidualGraph;
 using MaxFlow::Graphs::ResidualVertex;
 using MaxFlow::Graphs::ResidualEdge;
 using MaxFlow::Graphs::flow_t;
@@ -11,13 +10,23 @@ using MaxFlow::Graphs::flow_t;
 namespace MaxFlow::Solvers::PreflowPush
 {
 
+	namespace
+	{
+
+		size_t excessClass (flow_t _excess)
+		{
+			return static_cast<size_t>(std::bit_width (_excess - 1));
+		}
+
+	}
+
 	void ExcessScalingPreflowPushSolver::initialize ()
 	{
-		m_minDistance = 1;
+		const size_t verticesCount{ compactGraph ().verticesCount () };
 		m_excesses.clear ();
-		m_excesses.resize (graph ().verticesCount (), 0);
-		m_activeVerticesPerDistance.clear ();
-		m_activeVerticesPerDistance.resize (2 * graph ().verticesCount () - 1, {});
+		m_excesses.resize (verticesCount, 0);
+		m_largeExcesses.reset (verticesCount, 2 * verticesCount);
+		m_smallExcesses.reset (verticesCount, std::numeric_limits<flow_t>::digits + 1);
 		flow_t maxCapacity{ 0 };
 		for (const ResidualVertex& vertex : graph ())
 		{
@@ -29,22 +38,52 @@ namespace MaxFlow::Solvers::PreflowPush
 				}
 			}
 		}
-		m_delta = static_cast<flow_t>(std::pow (2, std::ceil (std::log2 (maxCapacity))));
+		m_delta = std::bit_ceil (maxCapacity);
+	}
+
+	bool ExcessScalingPreflowPushSolver::isTerminal (size_t _vertex) const
+	{
+		return _vertex == source ().index () || _vertex == sink ().index ();
 	}
 
-	void ExcessScalingPreflowPushSolver::addExcess (ResidualEdge& _edge, flow_t _amount)
+	void ExcessScalingPreflowPushSolver::updateExcess (size_t _vertex)
 	{
-		if (_edge.to () != source () && _edge.to () != sink ())
+		const flow_t excess{ m_excesses[_vertex] };
+		const bool large{ excess > m_delta / 2 };
+		if (m_largeExcesses.contains (_vertex))
 		{
-			if (!m_excesses[_edge.to ().index ()])
+			if (large)
 			{
-				push (_edge.to ());
+				return;
 			}
-			m_excesses[_edge.to ().index ()] += _amount;
+			m_largeExcesses.remove (_vertex);
 		}
-		if (_edge.from () != source () && _edge.from () != sink ())
+		else if (m_smallExcesses.contains (_vertex))
 		{
-			m_excesses[_edge.from ().index ()] -= _amount;
+			m_smallExcesses.remove (_vertex);
+		}
+		if (large)
+		{
+			m_largeExcesses.insert (_vertex, *label (_vertex), true);
+		}
+		else if (excess)
+		{
+			m_smallExcesses.insert (_vertex, excessClass (excess), false);
+		}
+	}
+
+	void ExcessScalingPreflowPushSolver::addExcess (size_t _arc, flow_t _amount)
+	{
+		const size_t to{ compactGraph ().head (_arc) }, from{ compactGraph ().tail (_arc) };
+		if (!isTerminal (to))
+		{
+			m_excesses[to] += _amount;
+			updateExcess (to);
+		}
+		if (!isTerminal (from))
+		{
+			m_excesses[from] -= _amount;
+			updateExcess (from);
 		}
 	}
 
@@ -52,58 +91,42 @@ namespace MaxFlow::Solvers::PreflowPush
 	{
 		while (m_delta >= 1)
 		{
-			while (m_minDistance < m_activeVerticesPerDistance.size())
+			const size_t vertex{ m_largeExcesses.lowestActive () };
+			if (vertex != LabelBuckets::none)
+			{
+				return { .vertex{vertex}, .amount{m_excesses[vertex]} };
+			}
+			m_delta /= 2;
+			if (m_delta)
 			{
-				while (!m_activeVerticesPerDistance[m_minDistance].empty ())
+				// Small excesses are at most the old delta / 2, so only the top class becomes large
+				const size_t promotedClass{ static_cast<size_t>(std::countr_zero (m_delta)) };
+				size_t next{ m_smallExcesses.firstInactive (promotedClass) };
+				while (next != LabelBuckets::none)
 				{
-					ResidualVertex& vertex{ *m_activeVerticesPerDistance[m_minDistance].front () };
-					if (m_excesses[vertex.index ()] && label (vertex) == m_minDistance)
-					{
-						return { .pVertex{&vertex}, .amount{m_excesses[vertex.index ()]} };
-					}
-					m_activeVerticesPerDistance[m_minDistance].pop ();
+					const size_t promoted{ next };
+					next = m_smallExcesses.next (promoted);
+					m_smallExcesses.remove (promoted);
+					m_largeExcesses.insert (promoted, *label (promoted), true);
 				}
-				m_minDistance++;
 			}
-			m_delta /= 2;
-			updateActiveNodes ();
 		}
 		return {};
 	}
 
-	void ExcessScalingPreflowPushSolver::onRelabel (Graphs::ResidualVertex& _vertex, size_t _oldDistance)
-	{
-		push (_vertex);
-	}
-
-	void ExcessScalingPreflowPushSolver::push (Graphs::ResidualVertex& _vertex)
+	void ExcessScalingPreflowPushSolver::onRelabel (size_t _vertex, size_t _oldDistance)
 	{
-		const size_t newDistance{ *label (_vertex) };
-		if (newDistance < m_minDistance)
-		{
-			m_minDistance = newDistance;
-		}
-		m_activeVerticesPerDistance[newDistance].push (&_vertex);
-	}
-
-	flow_t ExcessScalingPreflowPushSolver::maximumPushAmount (const Graphs::ResidualEdge& _edge, Excess _fromExcess) const
-	{
-		return m_delta - m_excesses[_edge.to ().index ()];
+		m_largeExcesses.relabel (_vertex, *label (_vertex));
 	}
 
-	void ExcessScalingPreflowPushSolver::updateActiveNodes ()
+	flow_t ExcessScalingPreflowPushSolver::maximumPushAmount (size_t _arc, Excess _fromExcess) const
 	{
-		for (size_t i{ 0 }; i < m_activeVerticesPerDistance.size (); i++)
+		const size_t to{ compactGraph ().head (_arc) };
+		if (isTerminal (to))
 		{
-			m_activeVerticesPerDistance[i] = {};
-		}
-		for (ResidualVertex& vertex : graph ())
-		{
-			if (m_excesses[vertex.index ()] > m_delta / 2)
-			{
-				push (vertex);
-			}
+			return std::numeric_limits<flow_t>::max ();
 		}
+		return m_excesses[to] < m_delta ? m_delta - m_excesses[to] : 0;
 	}
 
 }
\ No newline at end of file
@@ -1,9 +1,6 @@
 #include <max-flow/solvers/preflow_push/fifo.hpp>
 
 
-using MaxFlow::Graphs::ResidualGraph;
-using MaxFlow::Graphs::ResidualVertex;
-using MaxFlow::Graphs::ResidualEdge;
 using MaxFlow::Graphs::flow_t;
 
 namespace MaxFlow::Solvers::PreflowPush
@@ -12,23 +9,24 @@ namespace MaxFlow::Solvers::PreflowPush
 	void FifoPreflowPushSolver::initialize ()
 	{
 		m_excesses.clear ();
-		m_excesses.resize (graph ().verticesCount (), 0);
-		m_activeVertices = {};
+		m_excesses.resize (compactGraph ().verticesCount (), 0);
+		m_activeVertices.reset (compactGraph ().verticesCount ());
 	}
 
-	void FifoPreflowPushSolver::addExcess (ResidualEdge& _edge, flow_t _amount)
+	void FifoPreflowPushSolver::addExcess (size_t _arc, flow_t _amount)
 	{
-		if (_edge.to () != source () && _edge.to () != sink ())
+		const size_t to{ compactGraph ().head (_arc) }, from{ compactGraph ().tail (_arc) };
+		if (to != source ().index () && to != sink ().index ())
 		{
-			if (!m_excesses[_edge.to ().index ()])
+			if (_amount)
 			{
-				m_activeVertices.push (&_edge.to ());
+				m_activeVertices.push (to);
 			}
-			m_excesses[_edge.to ().index ()] += _amount;
+			m_excesses[to] += _amount;
 		}
-		if (_edge.from () != source () && _edge.from () != sink ())
+		if (from != source ().index () && from != sink ().index ())
 		{
-			m_excesses[_edge.from ().index ()] -= _amount;
+			m_excesses[from] -= _amount;
 		}
 	}
 
@@ -36,14 +34,29 @@ namespace MaxFlow::Solvers::PreflowPush
 	{
 		while (!m_activeVertices.empty ())
 		{
-			ResidualVertex& vertex{ *m_activeVertices.front () };
-			if (m_excesses[vertex.index ()])
+			const size_t vertex{ m_activeVertices.front () };
+			if (m_excesses[vertex])
 			{
-				return { .pVertex{&vertex}, .amount{m_excesses[vertex.index ()]} };
+				return { .vertex{vertex}, .amount{m_excesses[vertex]} };
 			}
 			m_activeVertices.pop ();
 		}
 		return {};
 	}
 
+	void FifoPreflowPushSolver::setActive (size_t _vertex, bool _active)
+	{
+		if (_active)
+		{
+			if (m_excesses[_vertex])
+			{
+				m_activeVertices.push (_vertex);
+			}
+		}
+		else
+		{
+			m_activeVertices.pop ();
+		}
+	}
+
 }
\ No newline at end of file
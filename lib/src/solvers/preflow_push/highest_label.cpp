@@ -1,9 +1,6 @@
 #include <max-flow/solvers/preflow_push/highest_label.hpp>
 
 
-using MaxFlow::Graphs::ResidualGraph;
-using MaxFlow::Graphs::ResidualVertex;
-using MaxFlow::Graphs::ResidualEdge;
 using MaxFlow::Graphs::flow_t;
 
 namespace MaxFlow::Solvers::PreflowPush
@@ -11,60 +8,66 @@ namespace MaxFlow::Solvers::PreflowPush
 
 	void HighestLabelPreflowPushSolver::initialize()
 	{
-		m_maxDistance = graph().verticesCount() - 1;
+		const size_t verticesCount{ compactGraph().verticesCount() };
 		m_excesses.clear();
-		m_excesses.resize(graph().verticesCount(), 0);
-		m_activeVerticesPerDistance.clear();
-		m_activeVerticesPerDistance.resize(2 * graph().verticesCount() - 1, {});
+		m_excesses.resize(verticesCount, 0);
+		m_buckets.reset(verticesCount, 2 * verticesCount);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (v != source().index() && v != sink().index() && label(v).valid())
+			{
+				m_buckets.insert(v, *label(v), false);
+			}
+		}
 	}
 
-	void HighestLabelPreflowPushSolver::addExcess(ResidualEdge& _edge, flow_t _amount)
+	void HighestLabelPreflowPushSolver::addExcess(size_t _arc, flow_t _amount)
 	{
-		if (_edge.to() != source() && _edge.to() != sink())
+		const size_t to{ compactGraph().head(_arc) }, from{ compactGraph().tail(_arc) };
+		if (to != source().index() && to != sink().index())
 		{
-			if (!m_excesses[_edge.to().index()])
+			if (!m_excesses[to] && _amount)
 			{
-				push(_edge.to());
+				m_buckets.setActive(to, true);
 			}
-			m_excesses[_edge.to().index()] += _amount;
+			m_excesses[to] += _amount;
 		}
-		if (_edge.from() != source() && _edge.from() != sink())
+		if (from != source().index() && from != sink().index())
 		{
-			m_excesses[_edge.from().index()] -= _amount;
+			m_excesses[from] -= _amount;
+			if (!m_excesses[from])
+			{
+				m_buckets.setActive(from, false);
+			}
 		}
 	}
 
 	PreflowPushSolver::Excess HighestLabelPreflowPushSolver::getExcess()
 	{
-		while (m_maxDistance > 0)
+		const size_t vertex{ m_buckets.highestActive() };
+		if (vertex == LabelBuckets::none)
 		{
-			while (!m_activeVerticesPerDistance[m_maxDistance].empty())
-			{
-				ResidualVertex& vertex{ *m_activeVerticesPerDistance[m_maxDistance].front() };
-				if (m_excesses[vertex.index()] && label(vertex) == m_maxDistance)
-				{
-					return { .pVertex{&vertex}, .amount{m_excesses[vertex.index()]} };
-				}
-				m_activeVerticesPerDistance[m_maxDistance].pop();
-			}
-			m_maxDistance--;
+			return {};
 		}
-		return {};
+		return { .vertex{vertex}, .amount{m_excesses[vertex]} };
 	}
 
-	void HighestLabelPreflowPushSolver::onRelabel(Graphs::ResidualVertex& _vertex, size_t _oldDistance)
+	void HighestLabelPreflowPushSolver::onRelabel(size_t _vertex, size_t _oldDistance)
 	{
-		push(_vertex);
+		if (m_buckets.contains(_vertex))
+		{
+			m_buckets.relabel(_vertex, *label(_vertex));
+		}
+		else
+		{
+			// Capacity scaling can label a vertex that was unreachable in the previous phases
+			m_buckets.insert(_vertex, *label(_vertex), m_excesses[_vertex] != 0);
+		}
 	}
 
-	void HighestLabelPreflowPushSolver::push(Graphs::ResidualVertex& _vertex)
+	void HighestLabelPreflowPushSolver::setActive(size_t _vertex, bool _active)
 	{
-		const size_t newDistance{ *label(_vertex) };
-		if (newDistance > m_maxDistance)
-		{
-			m_maxDistance = newDistance;
-		}
-		m_activeVerticesPerDistance[newDistance].push(&_vertex);
+		m_buckets.setActive(_vertex, _active && m_excesses[_vertex]);
 	}
 
 }
\ No newline at end of file
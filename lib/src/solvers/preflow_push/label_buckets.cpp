@@ -0,0 +1,39 @@
+#include <max-flow/solvers/preflow_push/label_buckets.hpp>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	void LabelBuckets::reset (size_t _verticesCount, size_t _labelsCount)
+	{
+		m_buckets.assign (_labelsCount, {});
+		m_nodes.assign (_verticesCount, {});
+		m_maxActiveLabel = m_minActiveLabel = none;
+	}
+
+	size_t LabelBuckets::highestActive ()
+	{
+		while (m_maxActiveLabel != none)
+		{
+			if (m_buckets[m_maxActiveLabel].firstActive != none)
+			{
+				return m_buckets[m_maxActiveLabel].firstActive;
+			}
+			m_maxActiveLabel = m_maxActiveLabel ? m_maxActiveLabel - 1 : none;
+		}
+		return none;
+	}
+
+	size_t LabelBuckets::lowestActive ()
+	{
+		while (m_minActiveLabel != none)
+		{
+			if (m_buckets[m_minActiveLabel].firstActive != none)
+			{
+				return m_buckets[m_minActiveLabel].firstActive;
+			}
+			m_minActiveLabel = m_minActiveLabel + 1 < m_buckets.size () ? m_minActiveLabel + 1 : none;
+		}
+		return none;
+	}
+
+}
\ No newline at end of file
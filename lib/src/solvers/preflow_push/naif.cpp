@@ -1,9 +1,6 @@
 #include <max-flow/solvers/preflow_push/naif.hpp>
 
 
-using MaxFlow::Graphs::ResidualGraph;
-using MaxFlow::Graphs::ResidualVertex;
-using MaxFlow::Graphs::ResidualEdge;
 using MaxFlow::Graphs::flow_t;
 
 
@@ -16,15 +13,16 @@ namespace MaxFlow::Solvers::PreflowPush
 		m_excesses.resize (graph ().verticesCount (), 0);
 	}
 
-	void NaifPreflowPushSolver::addExcess (ResidualEdge& _edge, flow_t _amount)
+	void NaifPreflowPushSolver::addExcess (size_t _arc, flow_t _amount)
 	{
-		if (_edge.to () != source () && _edge.to () != sink ())
+		const size_t to{ compactGraph ().head (_arc) }, from{ compactGraph ().tail (_arc) };
+		if (to != source ().index () && to != sink ().index ())
 		{
-			m_excesses[_edge.to ().index ()] += _amount;
+			m_excesses[to] += _amount;
 		}
-		if (_edge.from () != source () && _edge.from () != sink ())
+		if (from != source ().index () && from != sink ().index ())
 		{
-			m_excesses[_edge.from ().index ()] -= _amount;
+			m_excesses[from] -= _amount;
 		}
 	}
 
@@ -34,7 +32,7 @@ namespace MaxFlow::Solvers::PreflowPush
 		{
 			if (m_excesses[i])
 			{
-				return { .pVertex{&graph ()[i]}, .amount{m_excesses[i]} };
+				return { .vertex{i}, .amount{m_excesses[i]} };
 			}
 		}
 		return {};
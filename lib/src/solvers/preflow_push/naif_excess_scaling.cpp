@@ -0,0 +1,97 @@
+#include <max-flow/solvers/preflow_push/naif_excess_scaling.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+using MaxFlow::Graphs::ResidualVertex;
+using MaxFlow::Graphs::ResidualEdge;
+using MaxFlow::Graphs::flow_t;
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	void NaifExcessScalingPreflowPushSolver::initialize ()
+	{
+		const size_t verticesCount{ compactGraph ().verticesCount () };
+		m_excesses.clear ();
+		m_excesses.resize (verticesCount, 0);
+		m_buckets.reset (verticesCount, 2 * verticesCount);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			if (v != source ().index () && v != sink ().index () && label (v).valid ())
+			{
+				m_buckets.insert (v, *label (v), false);
+			}
+		}
+		flow_t maxCapacity{ 0 };
+		for (const ResidualVertex& vertex : graph ())
+		{
+			for (const ResidualEdge& edge : vertex)
+			{
+				if (capacities ()[edge] > maxCapacity)
+				{
+					maxCapacity = capacities ()[edge];
+				}
+			}
+		}
+		m_delta = static_cast<flow_t>(std::pow (2, std::ceil (std::log2 (maxCapacity))));
+	}
+
+	void NaifExcessScalingPreflowPushSolver::addExcess (size_t _arc, flow_t _amount)
+	{
+		const size_t to{ compactGraph ().head (_arc) }, from{ compactGraph ().tail (_arc) };
+		if (to != source ().index () && to != sink ().index ())
+		{
+			if (!m_excesses[to] && _amount)
+			{
+				m_buckets.setActive (to, true);
+			}
+			m_excesses[to] += _amount;
+		}
+		if (from != source ().index () && from != sink ().index ())
+		{
+			m_excesses[from] -= _amount;
+			if (!m_excesses[from])
+			{
+				m_buckets.setActive (from, false);
+			}
+		}
+	}
+
+	PreflowPushSolver::Excess NaifExcessScalingPreflowPushSolver::getExcess ()
+	{
+		while (m_delta >= 1)
+		{
+			const size_t vertex{ m_buckets.lowestActive () };
+			if (vertex != LabelBuckets::none)
+			{
+				return { .vertex{vertex}, .amount{m_excesses[vertex]} };
+			}
+			m_delta /= 2;
+			updateActiveNodes ();
+		}
+		return {};
+	}
+
+	void NaifExcessScalingPreflowPushSolver::onRelabel (size_t _vertex, size_t _oldDistance)
+	{
+		m_buckets.relabel (_vertex, *label (_vertex));
+	}
+
+	flow_t NaifExcessScalingPreflowPushSolver::maximumPushAmount (size_t _arc, Excess _fromExcess) const
+	{
+		return m_delta - m_excesses[compactGraph ().head (_arc)];
+	}
+
+	void NaifExcessScalingPreflowPushSolver::updateActiveNodes ()
+	{
+		for (size_t v{ 0 }; v < m_excesses.size (); v++)
+		{
+			if (m_buckets.contains (v))
+			{
+				m_buckets.setActive (v, m_excesses[v] > m_delta / 2);
+			}
+		}
+	}
+
+}
\ No newline at end of file
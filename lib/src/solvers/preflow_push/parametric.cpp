@@ -0,0 +1,262 @@
+#include <max-flow/solvers/preflow_push/parametric.hpp>
+
+#include <max-flow/solvers/preflow_push/fifo.hpp>
+#include <max-flow/solvers/preflow_push/highest_label.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+using MaxFlow::Graphs::ResidualGraph;
+using MaxFlow::Graphs::ResidualVertex;
+using MaxFlow::Graphs::ResidualEdge;
+using MaxFlow::Graphs::CompactResidualGraph;
+using MaxFlow::Graphs::flow_t;
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	ParametricPreflowPushSolver::ParametricPreflowPushSolver (ResidualGraph& _graph, ResidualVertex& _source, ResidualVertex& _sink, const CapacityMatrix& _capacityMatrix, const ParametricCapacities& _parametricCapacities)
+		: Solver{ _graph, _source, _sink, _capacityMatrix }, m_parametricCapacities{ _parametricCapacities }
+	{}
+
+	ParametricPreflowPushSolver::~ParametricPreflowPushSolver ()
+	{
+		delete m_pSubSolver;
+	}
+
+	PreflowPushSolver& ParametricPreflowPushSolver::subSolverInstance ()
+	{
+		if (!m_pSubSolver || m_subSolverType != subSolver ())
+		{
+			delete m_pSubSolver;
+			m_pSubSolver = nullptr;
+			switch (subSolver ())
+			{
+				case ESubSolver::FifoPreflowPush:
+					m_pSubSolver = new FifoPreflowPushSolver{ graph (), source (), sink (), capacities () };
+					break;
+				case ESubSolver::HighestLabelPreflowPush:
+					m_pSubSolver = new HighestLabelPreflowPushSolver{ graph (), source (), sink (), capacities () };
+					break;
+				default:
+					throw std::invalid_argument{ "unknown sub solver" };
+			}
+			m_subSolverType = subSolver ();
+		}
+		m_pSubSolver->setRemoveZeroEdges (areZeroEdgesRemoved ());
+		m_pSubSolver->resetSolveState ();
+		return *m_pSubSolver;
+	}
+
+	const ParametricCapacities& ParametricPreflowPushSolver::parametricCapacities () const
+	{
+		return m_parametricCapacities;
+	}
+
+	const std::vector<double>& ParametricPreflowPushSolver::parameters () const
+	{
+		return m_parameters;
+	}
+
+	void ParametricPreflowPushSolver::setParameters (const std::vector<double>& _parameters)
+	{
+		if (!std::is_sorted (_parameters.begin (), _parameters.end ()))
+		{
+			throw std::invalid_argument{ "parameters not sorted" };
+		}
+		m_parameters = _parameters;
+	}
+
+	ParametricPreflowPushSolver::ESubSolver ParametricPreflowPushSolver::subSolver () const
+	{
+		return m_subSolver;
+	}
+
+	void ParametricPreflowPushSolver::setSubSolver (ESubSolver _subSolver)
+	{
+		m_subSolver = _subSolver;
+	}
+
+	const std::vector<ParametricPreflowPushSolver::ParameterCut>& ParametricPreflowPushSolver::parameterCuts () const
+	{
+		return m_parameterCuts;
+	}
+
+	size_t ParametricPreflowPushSolver::firstSourceSideCut (const ResidualVertex& _vertex) const
+	{
+		ResidualGraph::ensureSameGraph (_vertex.graph (), graph ());
+		return m_vertexParameterCuts[_vertex.index ()];
+	}
+
+	void ParametricPreflowPushSolver::solveImpl ()
+	{
+		if (m_parameters.empty ())
+		{
+			throw std::logic_error{ "no parameters" };
+		}
+		m_parameterCuts.clear ();
+		m_vertexParameterCuts.clear ();
+		m_vertexParameterCuts.resize (graph ().verticesCount (), noParameterCut);
+		m_currentFlow = 0;
+		setTerminalCapacities (m_parameters.front (), m_parameters.back ());
+		PreflowPushSolver& engine{ subSolverInstance () };
+		engine.loadCompactGraph ();
+		engine.prepare ();
+		for (size_t i{ 0 }; i < m_parameters.size (); i++)
+		{
+			if (i && stopRequested ())
+			{
+				break;
+			}
+			if (i)
+			{
+				updateTerminalCapacities (engine, m_parameters[i]);
+			}
+			engine.saturateSourceEdges ();
+			engine.run ();
+			m_currentFlow = flow (engine.compactGraph ());
+			addParameterCut (engine.compactGraph (), m_parameters[i]);
+		}
+		engine.storeCompactGraph ();
+	}
+
+	flow_t ParametricPreflowPushSolver::progressFlow ()
+	{
+		// Flow of the last completed parameter
+		return m_currentFlow;
+	}
+
+	flow_t ParametricPreflowPushSolver::progressUpperBound ()
+	{
+		// Terminal capacities change with the parameter
+		return Progress::unbounded;
+	}
+
+	void ParametricPreflowPushSolver::setTerminalCapacities (double _firstParameter, double _lastParameter)
+	{
+		// Terminal edges are created upfront, so that later updates only touch existing arcs
+		m_sourceCapacities.clear ();
+		m_sourceCapacities.resize (graph ().verticesCount (), 0);
+		m_sinkCapacities.clear ();
+		m_sinkCapacities.resize (graph ().verticesCount (), 0);
+		for (ResidualVertex& vertex : graph ())
+		{
+			if (vertex != source ())
+			{
+				const flow_t capacity{ m_parametricCapacities.sourceCapacity (vertex.index (), _firstParameter) };
+				ResidualEdge* pEdge{ source ().outEdgeIfExists (vertex) };
+				if (!pEdge && (capacity || m_parametricCapacities.sourceCapacity (vertex.index (), _lastParameter)))
+				{
+					pEdge = &source ().addOutEdge (vertex);
+				}
+				if (pEdge)
+				{
+					**pEdge = capacity;
+				}
+				m_sourceCapacities[vertex.index ()] = capacity;
+			}
+			if (vertex != source () && vertex != sink ())
+			{
+				const flow_t capacity{ m_parametricCapacities.sinkCapacity (vertex.index (), _firstParameter) };
+				ResidualEdge* pEdge{ vertex.outEdgeIfExists (sink ()) };
+				if (capacity && !pEdge)
+				{
+					pEdge = &vertex.addOutEdge (sink ());
+				}
+				if (pEdge)
+				{
+					**pEdge = capacity;
+				}
+				m_sinkCapacities[vertex.index ()] = capacity;
+			}
+		}
+	}
+
+	void ParametricPreflowPushSolver::updateTerminalCapacities (PreflowPushSolver& _subSolver, double _parameter)
+	{
+		CompactResidualGraph& residualGraph{ _subSolver.compactGraph () };
+		const size_t sourceIndex{ source ().index () }, sinkIndex{ sink ().index () };
+		for (size_t v{ 0 }; v < residualGraph.verticesCount (); v++)
+		{
+			if (v != sourceIndex)
+			{
+				const flow_t capacity{ m_parametricCapacities.sourceCapacity (v, _parameter) };
+				flow_t& oldCapacity{ m_sourceCapacities[v] };
+				if (capacity < oldCapacity)
+				{
+					throw std::logic_error{ "source capacity decreased" };
+				}
+				if (capacity > oldCapacity)
+				{
+					const size_t arc{ residualGraph.findArc (sourceIndex, v) };
+					if (arc == CompactResidualGraph::noArc)
+					{
+						throw std::logic_error{ "source capacity increased on a missing source arc" };
+					}
+					residualGraph.residual (arc) += capacity - oldCapacity;
+					oldCapacity = capacity;
+				}
+			}
+			if (v != sourceIndex && v != sinkIndex)
+			{
+				const flow_t capacity{ m_parametricCapacities.sinkCapacity (v, _parameter) };
+				flow_t& oldCapacity{ m_sinkCapacities[v] };
+				if (capacity > oldCapacity)
+				{
+					throw std::logic_error{ "sink capacity increased" };
+				}
+				if (capacity < oldCapacity)
+				{
+					const flow_t decrease{ oldCapacity - capacity };
+					oldCapacity = capacity;
+					const size_t arc{ residualGraph.findArc (v, sinkIndex) };
+					if (arc == CompactResidualGraph::noArc)
+					{
+						throw std::logic_error{ "sink capacity decreased on a missing sink arc" };
+					}
+					const flow_t residualDecrease{ std::min (residualGraph.residual (arc), decrease) };
+					residualGraph.residual (arc) -= residualDecrease;
+					const flow_t flowDecrease{ decrease - residualDecrease };
+					if (flowDecrease)
+					{
+						const size_t reverseArc{ residualGraph.reverse (arc) };
+						residualGraph.residual (reverseArc) -= flowDecrease;
+						_subSolver.addExcess (reverseArc, flowDecrease);
+					}
+				}
+			}
+		}
+	}
+
+	flow_t ParametricPreflowPushSolver::flow (const CompactResidualGraph& _graph) const
+	{
+		const size_t sinkIndex{ sink ().index () };
+		flow_t flow{};
+		for (size_t arc{ _graph.firstArc (sinkIndex) }; arc < _graph.endArc (sinkIndex); arc++)
+		{
+			flow += _graph.residual (arc);
+			flow -= capacities ().capacity (sinkIndex, _graph.head (arc));
+		}
+		return flow;
+	}
+
+	void ParametricPreflowPushSolver::addParameterCut (const CompactResidualGraph& _graph, double _parameter)
+	{
+		// Vertices that cannot reach the sink form the maximal source side
+		Graphs::Algorithms::DistanceLabeler cutLabeler{ _graph, source ().index (), sink ().index () };
+		cutLabeler.calculate ();
+		size_t sourceSideVerticesCount{};
+		for (size_t v{ 0 }; v < _graph.verticesCount (); v++)
+		{
+			if (!cutLabeler[v].valid ())
+			{
+				sourceSideVerticesCount++;
+				if (m_vertexParameterCuts[v] == noParameterCut)
+				{
+					m_vertexParameterCuts[v] = m_parameterCuts.size ();
+				}
+			}
+		}
+		m_parameterCuts.push_back ({ .parameter{_parameter}, .flow{flow (_graph)}, .sourceSideVerticesCount{sourceSideVerticesCount} });
+	}
+
+}
\ No newline at end of file
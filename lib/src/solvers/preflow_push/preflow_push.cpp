@@ -1,80 +1,412 @@
 #include <max-flow/solvers/preflow_push/preflow_push.hpp>
 
-#include <max-flow/graphs/algorithms/residual.hpp>
+#include <max-flow/graphs/algorithms/arc_scan.hpp>
 #include <limits>
+#include <stdexcept>
 #include <algorithm>
+#include <span>
 
-using MaxFlow::Graphs::ResidualGraph;
-using MaxFlow::Graphs::ResidualVertex;
-using MaxFlow::Graphs::ResidualEdge;
+using MaxFlow::Graphs::CompactResidualGraph;
+using MaxFlow::Graphs::DeltaResidualView;
+using MaxFlow::Graphs::Algorithms::DistanceLabeler;
 using MaxFlow::Graphs::flow_t;
 using Label = MaxFlow::Graphs::Algorithms::DistanceLabeler::Label;
 
 namespace MaxFlow::Solvers::PreflowPush
 {
 
+	namespace
+	{
+
+		struct ActiveArcSelector final : public Graphs::Algorithms::EdgeSelector
+		{
+
+			const DeltaResidualView& view;
+
+			ActiveArcSelector (const DeltaResidualView& _view) : view{ _view }
+			{}
+
+			bool operator() (const CompactResidualGraph& _graph, size_t _arc) override
+			{
+				return view.isActive (_arc);
+			}
+
+		};
+
+	}
+
 	bool PreflowPushSolver::Excess::isExcess() const
 	{
-		return pVertex && amount;
+		return amount;
 	}
 
 	void PreflowPushSolver::solveImpl()
 	{
+		loadCompactGraph();
+		prepare();
+		saturateSourceEdges();
+		run();
+		if (wasCancelled())
+		{
+			returnExcess();
+		}
+		storeCompactGraph();
+	}
+
+	flow_t PreflowPushSolver::progressUpperBound()
+	{
+		// Labels of a scaling phase only hold for the active arcs, so their gaps say nothing about the whole graph
+		const flow_t bound{ Solver::progressUpperBound() };
+		return m_pDeltaView ? bound : std::min(bound, gapCutCapacity(m_distanceLabeler.distances()));
+	}
+
+	void PreflowPushSolver::prepare()
+	{
+		m_pDeltaView = nullptr;
 		m_distanceLabeler.calculate();
-		m_distanceLabeler.setDistance(source(), graph().verticesCount());
+		m_distanceLabeler.setDistance(source().index(), compactGraph().verticesCount());
+		resetCurrentArcs();
+		m_parkedVertices.clear();
+		initialize();
+	}
+
+	void PreflowPushSolver::prepare(DeltaResidualView& _deltaView)
+	{
+		m_pDeltaView = &_deltaView;
+		ActiveArcSelector edgeSelector{ _deltaView };
+		m_distanceLabeler.calculate(edgeSelector);
+		m_distanceLabeler.setDistance(source().index(), compactGraph().verticesCount());
+		resetCurrentArcs();
+		m_parkedVertices.clear();
+		countLabels();
 		initialize();
-		for (ResidualEdge& edge : source())
+	}
+
+	void PreflowPushSolver::resetCurrentArcs()
+	{
+		m_currentArcs.assign(compactGraph().verticesCount(), 0);
+	}
+
+	void PreflowPushSolver::countLabels()
+	{
+		const size_t verticesCount{ compactGraph().verticesCount() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		m_labelCounts.assign(verticesCount, 0);
+		for (size_t v{ 0 }; v < verticesCount; v++)
 		{
-			if (label(edge.to()).valid()) {
-				const flow_t amount{ *edge };
-				Graphs::Algorithms::augment(edge, amount, areZeroEdgesRemoved());
-				addExcess(edge, amount);
+			if (distances[v] < verticesCount)
+			{
+				m_labelCounts[distances[v]]++;
 			}
 		}
-		Excess excess{ getExcess() };
-		while (excess.isExcess())
+	}
+
+	void PreflowPushSolver::liftAboveGap(size_t _vertex, size_t _oldDistance)
+	{
+		// Without it, excess stranded by a phase climbs one label at a time up to the vertices count, which costs as much as a whole unscaled run
+		const size_t verticesCount{ compactGraph().verticesCount() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		if (distances[_vertex] < verticesCount)
+		{
+			m_labelCounts[distances[_vertex]]++;
+		}
+		if (_oldDistance >= verticesCount || --m_labelCounts[_oldDistance])
 		{
-			bool foundAdmissibleEdge{};
-			for (ResidualEdge& edge : *excess.pVertex)
+			return;
+		}
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			const size_t oldDistance{ distances[v] };
+			if (oldDistance > _oldDistance && oldDistance < verticesCount)
+			{
+				m_labelCounts[oldDistance]--;
+				m_distanceLabeler.setDistance(v, verticesCount);
+				m_currentArcs[v] = 0;
+				onRelabel(v, oldDistance);
+			}
+		}
+	}
+
+	void PreflowPushSolver::repairLabels(const std::vector<size_t>& _arcs)
+	{
+		// Newly active arcs can only shorten distances, so labels are lowered until every active arc is valid again
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		const size_t sourceIndex{ source().index() }, sinkIndex{ sink().index() };
+		const auto lower{ [&](size_t _vertex, size_t _distance) {
+			if (_vertex != sourceIndex && _vertex != sinkIndex && distances[_vertex] > _distance)
+			{
+				const size_t oldDistance{ distances[_vertex] };
+				m_distanceLabeler.setDistance(_vertex, _distance);
+				m_currentArcs[_vertex] = 0;
+				onRelabel(_vertex, oldDistance);
+				m_repairQueue.push_back(_vertex);
+			}
+		} };
+		m_repairQueue.clear();
+		for (const size_t arc : _arcs)
+		{
+			const size_t head{ residualGraph.head(arc) };
+			if (residualGraph.residual(arc) && distances[head] != DistanceLabeler::noDistance)
 			{
-				if (m_distanceLabeler.isAdmissible(edge))
+				lower(residualGraph.tail(arc), distances[head] + 1);
+			}
+		}
+		for (size_t q{ 0 }; q < m_repairQueue.size(); q++)
+		{
+			const size_t vertex{ m_repairQueue[q] };
+			const size_t distance{ distances[vertex] + 1 };
+			for (size_t arc{ residualGraph.firstArc(vertex) }; arc < residualGraph.endArc(vertex); arc++)
+			{
+				const size_t reverse{ residualGraph.reverse(arc) };
+				if (residualGraph.residual(reverse) && m_pDeltaView->isActive(reverse))
 				{
-					const flow_t amount{ std::min(*edge, std::min(excess.amount, maximumPushAmount(edge, excess))) };
-					Graphs::Algorithms::augment(edge, amount, areZeroEdgesRemoved());
-					addExcess(edge, amount);
-					foundAdmissibleEdge = true;
-					break;
+					lower(residualGraph.head(arc), distance);
 				}
 			}
-			if (!foundAdmissibleEdge)
+		}
+		countLabels();
+		for (const size_t vertex : m_parkedVertices)
+		{
+			setActive(vertex, true);
+		}
+		m_parkedVertices.clear();
+	}
+
+	void PreflowPushSolver::returnExcess()
+	{
+		// Every vertex with excess has a residual path back to the source that avoids the sink; each round grows one breadth first tree of such paths from the source and pushes the excesses along it, farthest vertices first, so that intermediate vertices forward what they receive
+		// Pushing toward the source never shortens the tree, so as in Edmonds-Karp every round but the last saturates an arc that stays out of the trees for a while
+		CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t verticesCount{ residualGraph.verticesCount() };
+		const size_t sourceIndex{ source().index() }, sinkIndex{ sink().index() };
+		std::vector<flow_t> excesses(verticesCount, 0);
+		for (size_t v{ 0 }; v < verticesCount; v++)
+		{
+			for (size_t arc{ residualGraph.firstArc(v) }; arc < residualGraph.endArc(v); arc++)
+			{
+				excesses[v] += residualGraph.residual(arc) - capacities().capacity(v, residualGraph.head(arc));
+			}
+		}
+		const auto hasExcess{ [&](size_t _vertex) {
+			return _vertex != sourceIndex && _vertex != sinkIndex && excesses[_vertex] > 0;
+		} };
+		std::vector<size_t>& predecessors{ m_returnPredecessors };
+		std::vector<size_t>& queue{ m_repairQueue };
+		bool pending{ false };
+		for (size_t v{ 0 }; v < verticesCount && !pending; v++)
+		{
+			pending = hasExcess(v);
+		}
+		while (pending)
+		{
+			predecessors.assign(verticesCount, CompactResidualGraph::noArc);
+			queue.clear();
+			queue.push_back(sourceIndex);
+			for (size_t q{ 0 }; q < queue.size(); q++)
 			{
-				size_t minDistance{ std::numeric_limits<size_t>::max() };
-				bool hasOutEdges{};
-				for (ResidualEdge& edge : *excess.pVertex)
+				const size_t vertex{ queue[q] };
+				for (size_t arc{ residualGraph.firstArc(vertex) }; arc < residualGraph.endArc(vertex); arc++)
 				{
-					if (*edge && m_distanceLabeler[edge.to()] < minDistance)
+					const size_t head{ residualGraph.head(arc) }, reverse{ residualGraph.reverse(arc) };
+					if (head != sourceIndex && head != sinkIndex && predecessors[head] == CompactResidualGraph::noArc && residualGraph.residual(reverse))
 					{
-						hasOutEdges = true;
-						minDistance = *m_distanceLabeler[edge.to()];
+						predecessors[head] = reverse;
+						queue.push_back(head);
 					}
 				}
-				const size_t oldDistance{ *m_distanceLabeler[*excess.pVertex] };
-				m_distanceLabeler.setDistance(*excess.pVertex, minDistance + 1);
-				onRelabel(*excess.pVertex, oldDistance);
+			}
+			for (size_t v{ 0 }; v < verticesCount; v++)
+			{
+				if (hasExcess(v) && predecessors[v] == CompactResidualGraph::noArc)
+				{
+					throw std::logic_error{ "excess without path to the source" };
+				}
+			}
+			pending = false;
+			for (size_t q{ queue.size() - 1 }; q > 0; q--)
+			{
+				const size_t vertex{ queue[q] };
+				if (excesses[vertex] > 0)
+				{
+					const size_t arc{ predecessors[vertex] };
+					const flow_t amount{ std::min(excesses[vertex], residualGraph.residual(arc)) };
+					residualGraph.augment(arc, amount);
+					excesses[vertex] -= amount;
+					excesses[residualGraph.head(arc)] += amount;
+					pending = pending || excesses[vertex] > 0;
+				}
+			}
+		}
+	}
+
+	void PreflowPushSolver::saturate(size_t _arc)
+	{
+		push(_arc, compactGraph().residual(_arc));
+	}
+
+	void PreflowPushSolver::saturateSourceEdges()
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		if (m_pDeltaView)
+		{
+			for (const size_t arc : m_pDeltaView->arcs(source().index()))
+			{
+				if (residualGraph.residual(arc) && label(residualGraph.head(arc)).valid())
+				{
+					saturate(arc);
+				}
+			}
+			return;
+		}
+		for (size_t arc{ residualGraph.firstArc(source().index()) }; arc < residualGraph.endArc(source().index()); arc++)
+		{
+			if (residualGraph.residual(arc) && label(residualGraph.head(arc)).valid())
+			{
+				saturate(arc);
+			}
+		}
+	}
+
+	void PreflowPushSolver::run()
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t verticesCount{ residualGraph.verticesCount() };
+		Excess excess{ getExcess() };
+		while (excess.isExcess() && !stopRequestedPeriodically())
+		{
+			const size_t vertex{ excess.vertex };
+			if (m_pDeltaView && m_distanceLabeler.distances()[vertex] >= verticesCount)
+			{
+				// Draining this excess back to the source would only have it pushed out again by the next phase
+				setActive(vertex, false);
+				m_parkedVertices.push_back(vertex);
+				excess = getExcess();
+				continue;
+			}
+			const size_t arc{ findAdmissibleArc(vertex) };
+			if (arc != CompactResidualGraph::noArc)
+			{
+				push(arc, std::min(residualGraph.residual(arc), std::min(excess.amount, maximumPushAmount(arc, excess))));
+			}
+			else
+			{
+				relabel(vertex);
 			}
 			excess = getExcess();
 		}
 	}
 
-	Label Solvers::PreflowPush::PreflowPushSolver::label(const ResidualVertex& _vertex) const
+	void PreflowPushSolver::push(size_t _arc, flow_t _amount)
+	{
+		addExcess(_arc, _amount);
+		if (m_pDeltaView)
+		{
+			m_pDeltaView->augment(_arc, _amount);
+		}
+		else
+		{
+			compactGraph().augment(_arc, _amount);
+		}
+	}
+
+	void PreflowPushSolver::relabel(size_t _vertex)
+	{
+		const size_t oldDistance{ *m_distanceLabeler[_vertex] };
+		m_distanceLabeler.setDistance(_vertex, minNeighborDistance(_vertex) + 1);
+		m_currentArcs[_vertex] = 0;
+		onRelabel(_vertex, oldDistance);
+		if (m_pDeltaView)
+		{
+			liftAboveGap(_vertex, oldDistance);
+		}
+	}
+
+	size_t PreflowPushSolver::findAdmissibleArc(size_t _vertex)
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		const size_t distance{ distances[_vertex] };
+		if (!distance)
+		{
+			return CompactResidualGraph::noArc;
+		}
+		size_t& currentArc{ m_currentArcs[_vertex] };
+		if (!m_pDeltaView)
+		{
+			const size_t firstArc{ residualGraph.firstArc(_vertex) };
+			const size_t arc{ Graphs::Algorithms::findArcToDistance(residualGraph, distances, _vertex, distance - 1, firstArc + currentArc) };
+			currentArc = (arc == CompactResidualGraph::noArc ? residualGraph.endArc(_vertex) : arc) - firstArc;
+			return arc;
+		}
+		// Arcs activated later are appended to the list, so they are still ahead of the current arc
+		const std::span<const size_t> arcs{ m_pDeltaView->arcs(_vertex) };
+		for (; currentArc < arcs.size(); currentArc++)
+		{
+			const size_t arc{ arcs[currentArc] };
+			if (residualGraph.residual(arc) && distances[residualGraph.head(arc)] == distance - 1)
+			{
+				return arc;
+			}
+		}
+		return CompactResidualGraph::noArc;
+	}
+
+	size_t PreflowPushSolver::minNeighborDistance(size_t _vertex) const
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		const size_t* distances{ m_distanceLabeler.distances() };
+		if (!m_pDeltaView)
+		{
+			return Graphs::Algorithms::minHeadDistance(residualGraph, distances, _vertex);
+		}
+		size_t minDistance{ DistanceLabeler::noDistance };
+		for (const size_t arc : m_pDeltaView->arcs(_vertex))
+		{
+			if (residualGraph.residual(arc))
+			{
+				minDistance = std::min(minDistance, distances[residualGraph.head(arc)]);
+			}
+		}
+		return minDistance;
+	}
+
+	bool PreflowPushSolver::discharge(Excess _excess)
+	{
+		const CompactResidualGraph& residualGraph{ compactGraph() };
+		bool relabeled{ false };
+		while (_excess.isExcess())
+		{
+			const size_t arc{ findAdmissibleArc(_excess.vertex) };
+			if (arc != CompactResidualGraph::noArc)
+			{
+				const flow_t amount{ std::min(residualGraph.residual(arc), std::min(_excess.amount, maximumPushAmount(arc, _excess))) };
+				push(arc, amount);
+				_excess.amount -= amount;
+			}
+			else
+			{
+				relabel(_excess.vertex);
+				relabeled = true;
+			}
+		}
+		return relabeled;
+	}
+
+	Label Solvers::PreflowPush::PreflowPushSolver::label(size_t _vertex) const
 	{
 		return m_distanceLabeler[_vertex];
 	}
 
-	void PreflowPushSolver::onRelabel(ResidualVertex& _vertex, size_t _oldLabel)
+	void PreflowPushSolver::onRelabel(size_t _vertex, size_t _oldLabel)
 	{}
 
-	flow_t PreflowPushSolver::maximumPushAmount(const ResidualEdge& _edge, Excess _fromExcess) const
+	void PreflowPushSolver::setActive(size_t _vertex, bool _active)
+	{
+		throw std::logic_error{ "engine cannot run scaling phases" };
+	}
+
+	flow_t PreflowPushSolver::maximumPushAmount(size_t _arc, Excess _fromExcess) const
 	{
 		return std::numeric_limits<flow_t>::max();
 	}
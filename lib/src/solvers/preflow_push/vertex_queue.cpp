@@ -0,0 +1,23 @@
+#include <max-flow/solvers/preflow_push/vertex_queue.hpp>
+
+namespace MaxFlow::Solvers::PreflowPush
+{
+
+	void VertexQueue::reset (size_t _verticesCount)
+	{
+		if (m_vertices.size () != _verticesCount)
+		{
+			m_vertices.assign (_verticesCount, 0);
+			m_queued.assign (_verticesCount, false);
+			m_front = m_size = 0;
+			return;
+		}
+		// Only the vertices still queued need to be unflagged
+		while (!empty ())
+		{
+			pop ();
+		}
+		m_front = 0;
+	}
+
+}
\ No newline at end of file